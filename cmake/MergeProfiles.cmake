@@ -0,0 +1,11 @@
+# Merge the raw Clang profiles in DIR into DIR/default.profdata
+file(GLOB raw_profiles "${DIR}/*.profraw")
+if(NOT raw_profiles)
+    message(FATAL_ERROR "No raw profiles found in ${DIR}")
+endif()
+execute_process(
+    COMMAND ${PROFDATA} merge -output=${DIR}/default.profdata ${raw_profiles}
+    RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "llvm-profdata merge failed")
+endif()
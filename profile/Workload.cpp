@@ -0,0 +1,97 @@
+// Representative workload used to collect profiles for profile guided
+// optimization. It exercises the hot paths of the library on synthetic data
+// and prints a checksum so the work cannot be optimized away.
+
+#include "Async/Async.h"
+#include "FastMath.h"
+#include "Geometry/AABB3Batch.h"
+#include "Geometry/SweepAndPrune.h"
+#include "Mat.h"
+#include "Mat3.h"
+#include "Reduce.h"
+#include "VecKernels.h"
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+    // Small deterministic generator so every profiling run sees the same data
+    class Lcg {
+
+    public:
+
+        explicit Lcg(uint32_t seed) : state(seed) {}
+
+        float Next(float low, float high) {
+            state = state * 1664525u + 1013904223u;
+            return low + (high - low) * float(state >> 8) / float(1u << 24);
+        }
+
+    private:
+
+        uint32_t state;
+
+    };
+
+}
+
+int main() {
+    using namespace Math;
+
+    constexpr size_t Count = 1 << 18;
+    Lcg random(12345);
+    double checksum = 0;
+
+    std::vector<Vec3<float>> points;
+    std::vector<float> angles;
+    for (size_t index = 0; index < Count; index++) {
+        points.emplace_back(random.Next(-100, 100), random.Next(-100, 100), random.Next(-100, 100));
+        angles.push_back(random.Next(-10, 10));
+    }
+
+    // Matrix transforms and inverses
+    Mat3<float> rotation(0, -1, 0, 1, 0, 0, 0, 0, 1);
+    std::vector<Vec3<float>> transformed(Count, Vec3<float>::Origin);
+    Async::Transform(rotation, points.data(), transformed.data(), Count).get();
+    Mat<float, 4, 4> transform(2, 0, 0, 1, 0, 2, 0, 2, 0, 0, 2, 3, 0, 0, 0, 1);
+    for (size_t index = 0; index < 1000; index++) {
+        checksum += transform.Inverse().Determinant() + rotation.Inverse().Determinant();
+    }
+
+    // Dot and cross kernels and reductions
+    std::vector<float> dots(Count);
+    VecKernels::Dot(points.data(), transformed.data(), dots.data(), Count);
+    VecKernels::Cross(points.data(), transformed.data(), transformed.data(), Count);
+    checksum += Reduce::Sum(dots.data(), Count);
+    checksum += Async::Sum(dots.data(), Count).get();
+
+    // Elementary functions
+    std::vector<float> sines(Count), cosines(Count);
+    FastMath::SinCos(angles.data(), sines.data(), cosines.data(), Count);
+    FastMath::Atan2(sines.data(), cosines.data(), dots.data(), Count);
+    checksum += Reduce::Dot(sines.data(), cosines.data(), Count) + Reduce::Sum(dots.data(), Count);
+
+    // Ray against boxes and broadphase
+    AABB3Batch<float, 8> boxes;
+    for (size_t lane = 0; lane < 8; lane++) {
+        const Vec3<float>& corner = points[lane];
+        boxes.Set(lane, AABB3<float>(corner, corner.Add(10, 10, 10)));
+    }
+    for (size_t index = 0; index + 1 < Count; index += 2) {
+        Ray3<float> ray(Vec3<float>::Origin, points[index]);
+        checksum += boxes.Intersect(ray).mask;
+    }
+    std::vector<AABB3<float>> objects;
+    for (size_t index = 0; index < Count; index++) {
+        const Vec3<float>& corner = points[index];
+        objects.emplace_back(corner, corner.Add(1, 1, 1));
+    }
+    SweepAndPrune<float> broadphase;
+    broadphase.Update(objects.data(), objects.size());
+    checksum += double(broadphase.FindPairs().size());
+
+    std::cout << "MathUtil workload checksum: " << checksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include "CancellationToken.h"
+#include "Progress.h"
+#include "ThreadPool.h"
+#include "../Config.h"
+#include "../Exception/AsyncException.h"
+#include "../Mat3.h"
+#include "../Reduce.h"
+#include "../Vec3.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Math {
+
+    // Non-blocking batched operations. Each call splits its work into chunks,
+    // queues them on a ThreadPool and returns a std::future at once, so the
+    // calling thread (for example an I/O event loop) keeps running. Errors
+    // thrown by a chunk, and cancellation, surface when the future is read.
+    // Callers must keep the input and output arrays alive until then. Code
+    // running inside a pool task must wait with ThreadPool::Wait, which runs
+    // queued tasks meanwhile, instead of blocking in get().
+    namespace Async {
+
+        struct Options {
+            // Pool to run on, ThreadPool::Shared() when null
+            ThreadPool* pool = nullptr;
+            // Checked before each chunk starts
+            CancellationToken token;
+            // Advanced by the number of items in each finished chunk
+            Progress progress;
+            // Number of items per chunk
+            size_t grain = 4096;
+        };
+
+        namespace Detail {
+
+            // Run body(begin, end) over [0, count) in chunks of grain items,
+            // then resolve the future with finish() once every chunk is done
+            template<typename Result, typename Body, typename Finish>
+            std::future<Result> Run(
+                size_t count, size_t grain, const Options& options, Body body, Finish finish) {
+
+                struct State {
+                    State(Body body, Finish finish, const Options& options, size_t chunks) :
+                        body(std::move(body)), finish(std::move(finish)),
+                        token(options.token), progress(options.progress), remaining(chunks) {}
+
+                    Body body;
+                    Finish finish;
+                    CancellationToken token;
+                    Progress progress;
+                    std::promise<Result> promise;
+                    std::atomic<size_t> remaining;
+                    std::atomic<bool> failed{ false };
+                    std::mutex errorMutex;
+                    std::exception_ptr error;
+                };
+
+                grain = std::max<size_t>(grain, 1);
+                size_t chunks = (count + grain - 1) / grain;
+                auto state = std::make_shared<State>(std::move(body), std::move(finish), options, chunks);
+                auto future = state->promise.get_future();
+                state->progress.Start(count);
+
+                auto complete = [](State& state) {
+                    if (state.error) {
+                        state.promise.set_exception(state.error);
+                    }
+                    else if (state.token.IsCancelled()) {
+                        state.promise.set_exception(
+                            std::make_exception_ptr(AsyncException(AsyncError::CANCELLED)));
+                    }
+                    else {
+                        try {
+                            if constexpr (std::is_void_v<Result>) {
+                                state.finish();
+                                state.promise.set_value();
+                            }
+                            else {
+                                state.promise.set_value(state.finish());
+                            }
+                        }
+                        catch (...) {
+                            state.promise.set_exception(std::current_exception());
+                        }
+                    }
+                };
+
+                if (chunks == 0) {
+                    complete(*state);
+                    return future;
+                }
+
+                ThreadPool& pool = options.pool ? *options.pool : ThreadPool::Shared();
+                for (size_t chunk = 0; chunk < chunks; chunk++) {
+                    size_t begin = chunk * grain;
+                    size_t end = std::min(begin + grain, count);
+                    pool.Submit([state, complete, begin, end] {
+                        if (!state->token.IsCancelled() && !state->failed.load(std::memory_order_relaxed)) {
+                            try {
+                                state->body(begin, end);
+                            }
+                            catch (...) {
+                                std::lock_guard<std::mutex> lock(state->errorMutex);
+                                if (!state->error) {
+                                    state->error = std::current_exception();
+                                }
+                                state->failed.store(true, std::memory_order_relaxed);
+                            }
+                            state->progress.Advance(end - begin);
+                        }
+                        if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                            complete(*state);
+                        }
+                    });
+                }
+                return future;
+            }
+
+        }
+
+        // Run body(begin, end) over [0, count) in parallel chunks
+        template<typename Body>
+        std::future<void> ParallelFor(size_t count, Body body, const Options& options = Options()) {
+            return Detail::Run<void>(count, options.grain, options, std::move(body), [] {});
+        }
+
+        // out[i] = matrix * in[i] for count vectors
+        template<typename T>
+        std::future<void> Transform(
+            const Mat3<T>& matrix, const Vec3<T>* in, Vec3<T>* out, size_t count,
+            const Options& options = Options()) {
+            return ParallelFor(count, [matrix, in, out](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; index++) {
+                    out[index] = matrix.Multiply(in[index]);
+                }
+            }, options);
+        }
+
+        // out[i] = first[i] * second[i] for count matrices
+        template<typename T>
+        std::future<void> Multiply(
+            const Mat3<T>* first, const Mat3<T>* second, Mat3<T>* out, size_t count,
+            const Options& options = Options()) {
+            return ParallelFor(count, [first, second, out](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; index++) {
+                    out[index] = first[index].Multiply(second[index]);
+                }
+            }, options);
+        }
+
+        // out[i] = in[i].Inverse() for count matrices, the future rethrows
+        // MatrixException if any of them is singular
+        template<typename T>
+        std::future<void> Inverse(
+            const Mat3<T>* in, Mat3<T>* out, size_t count,
+            const Options& options = Options()) {
+            return ParallelFor(count, [in, out](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; index++) {
+                    out[index] = in[index].Inverse();
+                }
+            }, options);
+        }
+
+        // Sum of count values. Chunks are whole ReductionBlockSize blocks and
+        // partials are combined with Reduce::TreeSum, so in deterministic mode
+        // the result matches Reduce::Sum bit for bit on any pool size.
+        template<typename T>
+        std::future<T> Sum(const T* values, size_t count, const Options& options = Options()) {
+            size_t blocks = (count + ReductionBlockSize - 1) / ReductionBlockSize;
+            size_t grain = std::max<size_t>(options.grain / ReductionBlockSize, 1) * ReductionBlockSize;
+            auto partials = std::make_shared<std::vector<T>>(blocks);
+            return Detail::Run<T>(count, grain, options,
+                [values, count, partials](size_t begin, size_t end) {
+                    for (size_t block = begin; block < end; block += ReductionBlockSize) {
+                        size_t length = std::min(ReductionBlockSize, count - block);
+                        (*partials)[block / ReductionBlockSize] = Reduce::BlockSum(values + block, length);
+                    }
+                },
+                [partials] {
+                    return Reduce::TreeSum(partials->data(), partials->size());
+                });
+        }
+
+    }
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace Math {
+
+    // Shared flag an owner sets to ask a running asynchronous operation to
+    // stop. Copies observe the same flag.
+    class CancellationToken {
+
+    public:
+
+        // Default constructor
+        CancellationToken() : cancelled(std::make_shared<std::atomic<bool>>(false)) {}
+
+        // Request cancellation of every operation holding this token
+        void Cancel() const { cancelled->store(true, std::memory_order_relaxed); }
+
+        // Check whether cancellation was requested
+        bool IsCancelled() const { return cancelled->load(std::memory_order_relaxed); }
+
+    private:
+
+        std::shared_ptr<std::atomic<bool>> cancelled;
+
+    };
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace Math {
+
+    // Shared counter of finished work items an event loop can poll while an
+    // asynchronous operation runs. Copies observe the same counters.
+    class Progress {
+
+    public:
+
+        // Default constructor
+        Progress() : state(std::make_shared<State>()) {}
+
+        // Get the number of finished items
+        size_t Completed() const { return state->completed.load(std::memory_order_relaxed); }
+
+        // Get the total number of items, 0 until the operation starts
+        size_t Total() const { return state->total.load(std::memory_order_relaxed); }
+
+        // Get the finished fraction in [0, 1]
+        double Fraction() const {
+            size_t total = Total();
+            return total == 0 ? 0.0 : double(Completed()) / double(total);
+        }
+
+        // Called by operations when they start
+        void Start(size_t total) const {
+            state->completed.store(0, std::memory_order_relaxed);
+            state->total.store(total, std::memory_order_relaxed);
+        }
+
+        // Called by operations as items finish
+        void Advance(size_t count) const {
+            state->completed.fetch_add(count, std::memory_order_relaxed);
+        }
+
+    private:
+
+        struct State {
+            std::atomic<size_t> completed{ 0 };
+            std::atomic<size_t> total{ 0 };
+        };
+
+        std::shared_ptr<State> state;
+
+    };
+
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Math {
+
+    // Fixed set of worker threads, each with its own task deque. Workers pop
+    // their own newest task first and steal the oldest task of another worker
+    // when they run dry, so large batches spread across cores without a
+    // single contended queue.
+    class ThreadPool {
+
+    public:
+
+        // Get the pool shared by every asynchronous operation that is not
+        // given an explicit pool, sized to the hardware
+        static ThreadPool& Shared() {
+            static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()));
+            return pool;
+        }
+
+        // Empty constructor
+        ThreadPool() = delete;
+
+        // Default constructor
+        explicit ThreadPool(size_t threadCount) : queues(std::max<size_t>(threadCount, 1)) {
+            for (size_t index = 0; index < queues.size(); index++) {
+                queues[index] = std::make_unique<Queue>();
+            }
+            for (size_t index = 0; index < queues.size(); index++) {
+                workers.emplace_back([this, index] { Run(index); });
+            }
+        }
+
+        // Copy constructor
+        ThreadPool(const ThreadPool& other) = delete;
+
+        // Move contstructor
+        ThreadPool(ThreadPool&& other) = delete;
+
+        // Destructor, finishes queued tasks before joining
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        // Copy assignment
+        ThreadPool& operator=(const ThreadPool& other) = delete;
+
+        // Move assignment
+        ThreadPool& operator=(ThreadPool&& other) = delete;
+
+        // Queue a task. Tasks submitted from a worker go to that worker's own
+        // deque, others are spread round robin.
+        void Submit(std::function<void()> task) {
+            const WorkerIdentity& worker = CurrentWorker();
+            size_t target = worker.pool == this
+                ? worker.index
+                : next.fetch_add(1, std::memory_order_relaxed) % queues.size();
+            {
+                std::lock_guard<std::mutex> lock(queues[target]->mutex);
+                queues[target]->tasks.push_back(std::move(task));
+            }
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                pending++;
+            }
+            wake.notify_one();
+        }
+
+        // Wait for a future and return its result. On a worker of this pool
+        // the wait runs queued tasks in the meantime, so use this instead of
+        // future.get() when waiting inside a task: a worker blocked in get()
+        // cannot run the tasks it waits for, which deadlocks a pool with one
+        // thread. Any other thread simply blocks, leaving the tasks to the
+        // workers so it never runs a task it did not ask for.
+        template<typename T>
+        T Wait(std::future<T>& future) {
+            const WorkerIdentity& worker = CurrentWorker();
+            if (worker.pool != this) {
+                return future.get();
+            }
+            while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                if (!RunOne(worker.index)) {
+                    // Nothing queued, the remaining tasks are running elsewhere
+                    future.wait_for(std::chrono::microseconds(100));
+                }
+            }
+            return future.get();
+        }
+
+        // Get the number of worker threads
+        size_t Size() const { return workers.size(); }
+
+    private:
+
+        struct Queue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        struct WorkerIdentity {
+            ThreadPool* pool = nullptr;
+            size_t index = 0;
+        };
+
+        // Identity of the pool worker running on the calling thread, if any
+        static WorkerIdentity& CurrentWorker() {
+            static thread_local WorkerIdentity identity;
+            return identity;
+        }
+
+        // Pop from our own deque, otherwise steal from the others
+        bool TryTake(size_t index, std::function<void()>& task) {
+            {
+                std::lock_guard<std::mutex> lock(queues[index]->mutex);
+                if (!queues[index]->tasks.empty()) {
+                    task = std::move(queues[index]->tasks.back());
+                    queues[index]->tasks.pop_back();
+                    return true;
+                }
+            }
+            for (size_t offset = 1; offset < queues.size(); offset++) {
+                auto& victim = *queues[(index + offset) % queues.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty()) {
+                    task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Take a task after claiming a pending count, which guarantees that
+        // some deque holds one
+        void RunClaimed(size_t index) {
+            std::function<void()> task;
+            while (!TryTake(index, task)) {
+                std::this_thread::yield();
+            }
+            task();
+        }
+
+        // Run one queued task without blocking, returns whether there was one
+        bool RunOne(size_t index) {
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                if (pending == 0) {
+                    return false;
+                }
+                pending--;
+            }
+            RunClaimed(index);
+            return true;
+        }
+
+        void Run(size_t index) {
+            CurrentWorker() = WorkerIdentity{ this, index };
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(wakeMutex);
+                    wake.wait(lock, [this] { return pending > 0 || stopping; });
+                    if (pending == 0 && stopping) {
+                        return;
+                    }
+                    pending--;
+                }
+                RunClaimed(index);
+            }
+        }
+
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<std::thread> workers;
+        std::atomic<size_t> next{ 0 };
+
+        std::mutex wakeMutex;
+        std::condition_variable wake;
+        size_t pending = 0;
+        bool stopping = false;
+
+    };
+
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+
+namespace Math {
+
+    // Forward mode automatic differentiation. A Dual carries a value and its
+    // derivatives with respect to N inputs, and every operation applies the
+    // chain rule to all N at once, so evaluating a function on Duals seeded
+    // with Variable gives its value and full gradient in one pass. Dual can be
+    // used as T in Vec2, Vec3, Vec, Mat2, Mat3 and Mat. Comparisons look at
+    // the value only.
+    template<typename T, size_t N = 1>
+    class Dual {
+
+    public:
+
+        // Empty constructor, zero
+        constexpr Dual() : value(0), derivatives{} {}
+
+        // Construct a constant
+        constexpr Dual(T value) : value(value), derivatives{} {}
+
+        // Construct from a value and its derivatives
+        constexpr Dual(T value, const std::array<T, N>& derivatives) :
+            value(value), derivatives(derivatives) {}
+
+        // Copy constructor
+        constexpr Dual(const Dual& other) = default;
+
+        // Move contstructor
+        constexpr Dual(Dual&& other) = default;
+
+        // Destructor
+        ~Dual() = default;
+
+        // Copy assignment
+        constexpr Dual& operator=(const Dual& other) = default;
+
+        // Move assignment
+        constexpr Dual& operator=(Dual&& other) = default;
+
+        // Input number index, its derivative with respect to itself is 1
+        static constexpr Dual Variable(T value, size_t index) {
+            Dual result(value);
+            result.derivatives[index] = T(1);
+            return result;
+        }
+
+        // Value of function at point and its gradient from one evaluation.
+        // function takes a const std::array<Dual, N>& and returns a Dual.
+        template<typename Function>
+        static T Gradient(const Function& function, const std::array<T, N>& point, std::array<T, N>& gradient) {
+            std::array<Dual, N> variables;
+            for (size_t index = 0; index < N; index++) {
+                variables[index] = Variable(point[index], index);
+            }
+            Dual result = function(variables);
+            gradient = result.derivatives;
+            return result.value;
+        }
+
+        constexpr Dual operator-() const {
+            return Scaled(-value, T(-1));
+        }
+
+        constexpr Dual& operator+=(const Dual& other) {
+            value += other.value;
+            for (size_t index = 0; index < N; index++) {
+                derivatives[index] += other.derivatives[index];
+            }
+            return *this;
+        }
+
+        constexpr Dual& operator-=(const Dual& other) {
+            value -= other.value;
+            for (size_t index = 0; index < N; index++) {
+                derivatives[index] -= other.derivatives[index];
+            }
+            return *this;
+        }
+
+        constexpr Dual& operator*=(const Dual& other) {
+            for (size_t index = 0; index < N; index++) {
+                derivatives[index] = derivatives[index] * other.value + value * other.derivatives[index];
+            }
+            value *= other.value;
+            return *this;
+        }
+
+        constexpr Dual& operator/=(const Dual& other) {
+            T inverse = T(1) / other.value;
+            value *= inverse;
+            for (size_t index = 0; index < N; index++) {
+                derivatives[index] = (derivatives[index] - value * other.derivatives[index]) * inverse;
+            }
+            return *this;
+        }
+
+        friend constexpr Dual operator+(Dual first, const Dual& second) { return first += second; }
+
+        friend constexpr Dual operator-(Dual first, const Dual& second) { return first -= second; }
+
+        friend constexpr Dual operator*(Dual first, const Dual& second) { return first *= second; }
+
+        friend constexpr Dual operator/(Dual first, const Dual& second) { return first /= second; }
+
+        friend constexpr bool operator==(const Dual& first, const Dual& second) { return first.value == second.value; }
+
+        friend constexpr bool operator!=(const Dual& first, const Dual& second) { return first.value != second.value; }
+
+        friend constexpr bool operator<(const Dual& first, const Dual& second) { return first.value < second.value; }
+
+        friend constexpr bool operator<=(const Dual& first, const Dual& second) { return first.value <= second.value; }
+
+        friend constexpr bool operator>(const Dual& first, const Dual& second) { return first.value > second.value; }
+
+        friend constexpr bool operator>=(const Dual& first, const Dual& second) { return first.value >= second.value; }
+
+        // Square root, found by argument dependent lookup like Math::Sqrt
+        friend Dual Sqrt(const Dual& dual) {
+            T root = std::sqrt(dual.value);
+            return dual.Scaled(root, T(0.5) / root);
+        }
+
+        friend Dual abs(const Dual& dual) {
+            return dual.Scaled(std::abs(dual.value), dual.value < T(0) ? T(-1) : T(1));
+        }
+
+        friend Dual sin(const Dual& dual) {
+            return dual.Scaled(std::sin(dual.value), std::cos(dual.value));
+        }
+
+        friend Dual cos(const Dual& dual) {
+            return dual.Scaled(std::cos(dual.value), -std::sin(dual.value));
+        }
+
+        friend Dual acos(const Dual& dual) {
+            return dual.Scaled(std::acos(dual.value), T(-1) / std::sqrt(T(1) - dual.value * dual.value));
+        }
+
+        friend Dual exp(const Dual& dual) {
+            T result = std::exp(dual.value);
+            return dual.Scaled(result, result);
+        }
+
+        friend Dual log(const Dual& dual) {
+            return dual.Scaled(std::log(dual.value), T(1) / dual.value);
+        }
+
+        friend Dual atan2(const Dual& y, const Dual& x) {
+            T scale = T(1) / (x.value * x.value + y.value * y.value);
+            Dual result(std::atan2(y.value, x.value));
+            for (size_t index = 0; index < N; index++) {
+                result.derivatives[index] = (x.value * y.derivatives[index] - y.value * x.derivatives[index]) * scale;
+            }
+            return result;
+        }
+
+        constexpr T GetValue() const { return value; }
+
+        constexpr T GetDerivative(size_t index = 0) const { return derivatives[index]; }
+
+        constexpr const std::array<T, N>& GetDerivatives() const { return derivatives; }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(std::ostream& stream, const Dual& dual) {
+            stream << dual.value << " {";
+            for (size_t index = 0; index < N; index++) {
+                stream << dual.derivatives[index] << (index + 1 < N ? ", " : "}");
+            }
+            return stream;
+        }
+
+    private:
+
+        // Result of an elementary function with the given value and derivative at this point
+        constexpr Dual Scaled(T result, T slope) const {
+            Dual scaled(result);
+            for (size_t index = 0; index < N; index++) {
+                scaled.derivatives[index] = derivatives[index] * slope;
+            }
+            return scaled;
+        }
+
+        T value;
+        std::array<T, N> derivatives;
+
+    };
+
+}
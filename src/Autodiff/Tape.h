@@ -0,0 +1,289 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace Math {
+
+    template<typename T>
+    class Tape;
+
+    // Reverse mode automatic differentiation. Every operation on a Var with
+    // a Tape appends one node holding the partial derivatives with respect to
+    // its operands, and Tape::Backward then sweeps the nodes once in reverse
+    // to get the derivative of one output with respect to every input, at
+    // about the cost of one more evaluation however many inputs there are.
+    // Vars built from plain values are constants and record nothing. Var can
+    // be used as T in Vec2, Vec3, Vec, Mat2, Mat3 and Mat. Comparisons look
+    // at the value only. A Var must not outlive or mix tapes.
+    template<typename T>
+    class Var {
+
+    public:
+
+        // Empty constructor, zero
+        constexpr Var() : Var(T(0)) {}
+
+        // Construct a constant
+        constexpr Var(T value) : value(value), tape(nullptr), index(Constant) {}
+
+        // Copy constructor
+        constexpr Var(const Var& other) = default;
+
+        // Move contstructor
+        constexpr Var(Var&& other) = default;
+
+        // Destructor
+        ~Var() = default;
+
+        // Copy assignment
+        constexpr Var& operator=(const Var& other) = default;
+
+        // Move assignment
+        constexpr Var& operator=(Var&& other) = default;
+
+        Var operator-() const { return Record(-value, *this, T(-1)); }
+
+        Var& operator+=(const Var& other) { return *this = *this + other; }
+
+        Var& operator-=(const Var& other) { return *this = *this - other; }
+
+        Var& operator*=(const Var& other) { return *this = *this * other; }
+
+        Var& operator/=(const Var& other) { return *this = *this / other; }
+
+        friend Var operator+(const Var& first, const Var& second) {
+            return Record(first.value + second.value, first, T(1), second, T(1));
+        }
+
+        friend Var operator-(const Var& first, const Var& second) {
+            return Record(first.value - second.value, first, T(1), second, T(-1));
+        }
+
+        friend Var operator*(const Var& first, const Var& second) {
+            return Record(first.value * second.value, first, second.value, second, first.value);
+        }
+
+        friend Var operator/(const Var& first, const Var& second) {
+            T inverse = T(1) / second.value;
+            T result = first.value * inverse;
+            return Record(result, first, inverse, second, -result * inverse);
+        }
+
+        friend constexpr bool operator==(const Var& first, const Var& second) { return first.value == second.value; }
+
+        friend constexpr bool operator!=(const Var& first, const Var& second) { return first.value != second.value; }
+
+        friend constexpr bool operator<(const Var& first, const Var& second) { return first.value < second.value; }
+
+        friend constexpr bool operator<=(const Var& first, const Var& second) { return first.value <= second.value; }
+
+        friend constexpr bool operator>(const Var& first, const Var& second) { return first.value > second.value; }
+
+        friend constexpr bool operator>=(const Var& first, const Var& second) { return first.value >= second.value; }
+
+        // Square root, found by argument dependent lookup like Math::Sqrt
+        friend Var Sqrt(const Var& var) {
+            T root = std::sqrt(var.value);
+            return Record(root, var, T(0.5) / root);
+        }
+
+        friend Var abs(const Var& var) {
+            return Record(std::abs(var.value), var, var.value < T(0) ? T(-1) : T(1));
+        }
+
+        friend Var sin(const Var& var) {
+            return Record(std::sin(var.value), var, std::cos(var.value));
+        }
+
+        friend Var cos(const Var& var) {
+            return Record(std::cos(var.value), var, -std::sin(var.value));
+        }
+
+        friend Var acos(const Var& var) {
+            return Record(std::acos(var.value), var, T(-1) / std::sqrt(T(1) - var.value * var.value));
+        }
+
+        friend Var exp(const Var& var) {
+            T result = std::exp(var.value);
+            return Record(result, var, result);
+        }
+
+        friend Var log(const Var& var) {
+            return Record(std::log(var.value), var, T(1) / var.value);
+        }
+
+        friend Var atan2(const Var& y, const Var& x) {
+            T scale = T(1) / (x.value * x.value + y.value * y.value);
+            return Record(std::atan2(y.value, x.value), y, x.value * scale, x, -y.value * scale);
+        }
+
+        constexpr T GetValue() const { return value; }
+
+        // Get the node index on the tape
+        constexpr uint32_t GetIndex() const { return index; }
+
+        // Whether this is a constant that is not on any tape
+        constexpr bool IsConstant() const { return index == Constant; }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(std::ostream& stream, const Var& var) {
+            stream << var.value;
+            return stream;
+        }
+
+    private:
+
+        friend class Tape<T>;
+
+        // Node index of constants
+        static constexpr uint32_t Constant = UINT32_MAX;
+
+        constexpr Var(T value, Tape<T>* tape, uint32_t index) : value(value), tape(tape), index(index) {}
+
+        // Result of an operation with one operand and its partial derivative
+        static Var Record(T result, const Var& operand, T partial) {
+            if (operand.tape == nullptr) {
+                return Var(result);
+            }
+            return Var(result, operand.tape, operand.tape->Push(operand.index, partial, Constant, T(0)));
+        }
+
+        // Result of an operation with two operands and their partial derivatives
+        static Var Record(T result, const Var& first, T firstPartial, const Var& second, T secondPartial) {
+            Tape<T>* tape = first.tape != nullptr ? first.tape : second.tape;
+            if (tape == nullptr) {
+                return Var(result);
+            }
+            return Var(result, tape, tape->Push(first.index, firstPartial, second.index, secondPartial));
+        }
+
+        T value;
+        Tape<T>* tape;
+        uint32_t index;
+
+    };
+
+    // Record of the operations on its Vars. Nodes live in fixed size blocks
+    // that are kept when the tape is cleared, so recording allocates nothing
+    // once the tape has grown to the size of the computation and growing it
+    // never moves existing nodes.
+    template<typename T>
+    class Tape {
+
+    public:
+
+        // Empty constructor
+        Tape() = default;
+
+        // Copy constructor, deleted since Vars point at their tape
+        Tape(const Tape& other) = delete;
+
+        // Move contstructor, deleted since Vars point at their tape
+        Tape(Tape&& other) = delete;
+
+        // Destructor
+        ~Tape() = default;
+
+        // Copy assignment, deleted since Vars point at their tape
+        Tape& operator=(const Tape& other) = delete;
+
+        // Move assignment, deleted since Vars point at their tape
+        Tape& operator=(Tape&& other) = delete;
+
+        // Create an input
+        Var<T> Variable(T value) {
+            return Var<T>(value, this, Push(Var<T>::Constant, T(0), Var<T>::Constant, T(0)));
+        }
+
+        // Forget every node, keeping the memory. Existing Vars become invalid.
+        void Clear() { size = 0; }
+
+        // Get the number of nodes
+        size_t Size() const { return size; }
+
+        // Derivatives of output with respect to every node, in one reverse sweep
+        const std::vector<T>& Backward(const Var<T>& output) {
+            adjoints.assign(size, T(0));
+            if (output.IsConstant()) {
+                return adjoints;
+            }
+            adjoints[output.GetIndex()] = T(1);
+            for (size_t index = output.GetIndex() + 1; index-- > 0;) {
+                T adjoint = adjoints[index];
+                if (adjoint == T(0)) {
+                    continue;
+                }
+                const Node& node = At(index);
+                for (int operand = 0; operand < 2; operand++) {
+                    if (node.operands[operand] != Var<T>::Constant) {
+                        adjoints[node.operands[operand]] += node.partials[operand] * adjoint;
+                    }
+                }
+            }
+            return adjoints;
+        }
+
+        // Get the derivative of the last Backward output with respect to a Var
+        T Derivative(const Var<T>& var) const {
+            return var.IsConstant() || var.GetIndex() >= adjoints.size() ? T(0) : adjoints[var.GetIndex()];
+        }
+
+        // Value of function at the count values in point and its gradient,
+        // from one evaluation and one reverse sweep. function takes a
+        // const Var<T>* to count inputs and returns a Var<T>. Clears the tape.
+        template<typename Function>
+        T Gradient(const Function& function, const T* point, size_t count, T* gradient) {
+            Clear();
+            inputs.clear();
+            for (size_t index = 0; index < count; index++) {
+                inputs.push_back(Variable(point[index]));
+            }
+            Var<T> result = function(static_cast<const Var<T>*>(inputs.data()));
+            Backward(result);
+            for (size_t index = 0; index < count; index++) {
+                gradient[index] = Derivative(inputs[index]);
+            }
+            return result.GetValue();
+        }
+
+    private:
+
+        friend class Var<T>;
+
+        static constexpr size_t BlockShift = 12;
+        static constexpr size_t BlockSize = size_t(1) << BlockShift;
+
+        struct Node {
+            uint32_t operands[2];
+            T partials[2];
+        };
+
+        uint32_t Push(uint32_t first, T firstPartial, uint32_t second, T secondPartial) {
+            if ((size >> BlockShift) == blocks.size()) {
+                blocks.emplace_back(new Node[BlockSize]);
+            }
+            Node& node = blocks[size >> BlockShift][size & (BlockSize - 1)];
+            node.operands[0] = first;
+            node.operands[1] = second;
+            node.partials[0] = firstPartial;
+            node.partials[1] = secondPartial;
+            return uint32_t(size++);
+        }
+
+        const Node& At(size_t index) const {
+            return blocks[index >> BlockShift][index & (BlockSize - 1)];
+        }
+
+        std::vector<std::unique_ptr<Node[]>> blocks;
+        size_t size = 0;
+        std::vector<T> adjoints;
+        std::vector<Var<T>> inputs;
+
+    };
+
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "Exception/MatrixException.h"
+#include "Mat3.h"
+#include "Vec3.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+
+namespace Math {
+
+    // A Mat3 that memoizes its inverse, determinant and transpose. They are
+    // computed on first use and reused until a mutator changes the matrix.
+    // Mutators only bump a version counter, so invalidation is lazy and costs
+    // nothing until the next lookup. Const methods may be called from many
+    // threads at once: a cache hit is one atomic load, and only the first
+    // lookup after a change takes the lock to refill the cache. Mutators need
+    // exclusive access, like those of any other type.
+    template<typename T>
+    class CachedMat3 {
+
+    public:
+
+        // Empty constructor, deleted since there is always a matrix to cache
+        CachedMat3() = delete;
+
+        // Default constructor, wraps matrix with an empty cache
+        explicit CachedMat3(const Mat3<T>& matrix) : matrix(matrix) {}
+
+        // Copy constructor, the cache comes along when it is up to date
+        CachedMat3(const CachedMat3& other) : matrix(other.matrix), version(other.version) {
+            CopyCache(other);
+        }
+
+        // Move contstructor
+        CachedMat3(CachedMat3&& other) : CachedMat3(static_cast<const CachedMat3&>(other)) {}
+
+        // Destructor
+        ~CachedMat3() = default;
+
+        // Copy assignment
+        CachedMat3& operator=(const CachedMat3& other) {
+            if (this != &other) {
+                matrix = other.matrix;
+                version = other.version;
+                CopyCache(other);
+            }
+            return *this;
+        }
+
+        // Move assignment
+        CachedMat3& operator=(CachedMat3&& other) {
+            return *this = static_cast<const CachedMat3&>(other);
+        }
+
+
+        // Const Multiply by other 3x3 Matrix
+        Mat3<T> Multiply(const Mat3<T>& other) const {
+            return matrix.Multiply(other);
+        }
+
+        // Const Multiply by Vec3
+        Vec3<T> Multiply(const Vec3<T>& other) const {
+            return matrix.Multiply(other);
+        }
+
+        // Const Transpose, cached
+        const Mat3<T>& Transpose() const {
+            return Cache().transpose;
+        }
+
+        // Const Scale
+        Mat3<T> Scale(T scalar) const {
+            return matrix.Scale(scalar);
+        }
+
+
+        // Mutator Multiply by other 3x3 Matrix
+        Mat3<T> Multiply(const Mat3<T>& other) {
+            Invalidate();
+            return matrix.Multiply(other);
+        }
+
+        // Mutator Transpose. Transposing is exact, so an up to date cache is
+        // transposed along with the matrix instead of being dropped.
+        Mat3<T> Transpose() {
+            bool cached = cachedVersion.load(std::memory_order_relaxed) == version;
+            Invalidate();
+            if (cached) {
+                Mat3<T> previous = matrix;
+                matrix = cache.transpose;
+                cache.transpose = previous;
+                cache.inverse = cache.inverse.Transpose();
+                cachedVersion.store(version, std::memory_order_relaxed);
+                return matrix;
+            }
+            return matrix.Transpose();
+        }
+
+        // Mutator Scale
+        Mat3<T> Scale(T scalar) {
+            Invalidate();
+            return matrix.Scale(scalar);
+        }
+
+        // Mutator Set, replaces the whole matrix
+        void Set(const Mat3<T>& other) {
+            Invalidate();
+            matrix = other;
+        }
+
+
+        // Get the determinant of this matrix, cached
+        T Determinant() const {
+            return Cache().determinant;
+        }
+
+        // Get the inverse of this matrix, cached
+        const Mat3<T>& Inverse() const {
+            const Entry& entry = Cache();
+            if (!entry.invertible) {
+                throw MatrixException(MatrixError::NOT_INVERTIBLE);
+            }
+            return entry.inverse;
+        }
+
+        // Solve for x in the equation Ax = b with the cached inverse
+        Vec3<T> Solve(const Vec3<T>& bVec) const {
+            return Inverse().Multiply(bVec);
+        }
+
+        const Mat3<T>& GetMatrix() const { return matrix; }
+
+        // Get the version, which every mutator increments
+        uint64_t GetVersion() const { return version; }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(
+            std::ostream& stream, const CachedMat3<T>& mat) {
+            stream << mat.matrix;
+            return stream;
+        }
+
+    private:
+
+        struct Entry {
+            Mat3<T> inverse = Mat3<T>::Identity;
+            Mat3<T> transpose = Mat3<T>::Identity;
+            T determinant = T(0);
+            bool invertible = false;
+        };
+
+        // No version is ever equal to this
+        static constexpr uint64_t Stale = UINT64_MAX;
+
+        void Invalidate() {
+            version++;
+            cachedVersion.store(Stale, std::memory_order_relaxed);
+        }
+
+        // The entry is only written while cachedVersion differs from version,
+        // under the lock, and published by the release store, so readers that
+        // see the versions match can use it without locking
+        const Entry& Cache() const {
+            if (cachedVersion.load(std::memory_order_acquire) == version) {
+                return cache;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            if (cachedVersion.load(std::memory_order_relaxed) != version) {
+                cache.determinant = matrix.Determinant();
+                cache.invertible = cache.determinant != T(0);
+                if (cache.invertible) {
+                    cache.inverse = matrix.Inverse();
+                }
+                cache.transpose = matrix.Transpose();
+                cachedVersion.store(version, std::memory_order_release);
+            }
+            return cache;
+        }
+
+        void CopyCache(const CachedMat3& other) {
+            if (other.cachedVersion.load(std::memory_order_acquire) == other.version) {
+                cache = other.cache;
+                cachedVersion.store(version, std::memory_order_relaxed);
+            }
+            else {
+                cachedVersion.store(Stale, std::memory_order_relaxed);
+            }
+        }
+
+        Mat3<T> matrix;
+        uint64_t version = 0;
+        mutable Entry cache;
+        mutable std::atomic<uint64_t> cachedVersion{ Stale };
+        mutable std::mutex mutex;
+
+    };
+
+}
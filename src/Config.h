@@ -0,0 +1,55 @@
+#pragma once
+
+// Library-wide build configuration.
+//
+// Define MATHUTIL_DETERMINISTIC (or configure with -DMATHUTIL_DETERMINISTIC=ON)
+// to get bit-identical results across machines, instruction sets and thread
+// counts. In this mode reductions use a fixed-order summation tree whose shape
+// depends only on the element count, and floating point contraction is off so
+// no multiply-add is fused differently on FMA hardware. The other sums, such
+// as Vec::Dot, Magnitude and the VecKernels, add in source order, which
+// compilers keep without -ffast-math. Results that go through libm (AngleTo,
+// the Dual and Tape transcendentals) still depend on the platform's libm.
+//
+// The CMake option compiles every target with -ffp-contract=off (/fp:precise
+// on MSVC). Defining the macro by hand turns contraction off with a pragma on
+// Clang and MSVC, for the rest of each translation unit that includes this
+// header. GCC ignores that pragma, so GCC builds must pass -ffp-contract=off
+// themselves.
+
+#if defined(MATHUTIL_DETERMINISTIC) && defined(__FAST_MATH__)
+#error "MATHUTIL_DETERMINISTIC cannot be combined with -ffast-math"
+#endif
+
+#if defined(MATHUTIL_DETERMINISTIC)
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#endif
+#endif
+
+#include <cstddef>
+
+// Marks a pointer argument that no other pointer argument overlaps. Loops
+// writing several arrays need it to vectorize without runtime overlap checks.
+#if defined(__GNUC__) || defined(_MSC_VER)
+#define MATHUTIL_RESTRICT __restrict
+#else
+#define MATHUTIL_RESTRICT
+#endif
+
+namespace Math {
+
+#if defined(MATHUTIL_DETERMINISTIC)
+    constexpr bool Deterministic = true;
+#else
+    constexpr bool Deterministic = false;
+#endif
+
+    // Number of elements summed sequentially before results are combined by
+    // the summation tree. Parallel reductions split work on multiples of this
+    // size so every partition produces the same partial sums.
+    constexpr size_t ReductionBlockSize = 256;
+
+}
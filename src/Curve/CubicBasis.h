@@ -0,0 +1,16 @@
+#pragma once
+
+namespace Math {
+
+    // Control point conventions understood by CubicCurveArray3. Every basis is
+    // converted to power form a + b t + c t^2 + d t^3 when a curve is added.
+    enum class CubicBasis {
+        // p0 and p3 are the end points, p1 and p2 the handles
+        BEZIER,
+        // Uniform Catmull-Rom segment running from p1 to p2
+        CATMULL_ROM,
+        // Uniform cubic B-spline segment, which approximates p1 to p2
+        B_SPLINE
+    };
+
+}
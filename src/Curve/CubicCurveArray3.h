@@ -0,0 +1,235 @@
+#pragma once
+
+#include "CubicBasis.h"
+#include "../Vec3.h"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Math {
+
+    // Many cubic Vec3 curve segments stored in power form, one array per
+    // coefficient component (SoA). Evaluating every curve at one parameter,
+    // or one curve at many parameters, runs as a straight loop the compiler
+    // vectorizes. Each curve's arc-length table is built when it is added,
+    // so const methods are safe to call from several threads at once.
+    template<typename T>
+    class CubicCurveArray3 {
+
+    public:
+
+        // Number of chords used to approximate the arc length of each curve
+        static constexpr size_t ArcLengthSamples = 64;
+
+        // Empty constructor
+        CubicCurveArray3() = default;
+
+        // Copy constructor
+        CubicCurveArray3(const CubicCurveArray3<T>& other) = default;
+
+        // Move contstructor
+        CubicCurveArray3(CubicCurveArray3&& other) = default;
+
+        // Destructor
+        ~CubicCurveArray3() = default;
+
+        // Copy assignment
+        CubicCurveArray3& operator=(const CubicCurveArray3& other) = default;
+
+        // Move assignment
+        CubicCurveArray3& operator=(CubicCurveArray3&& other) = default;
+
+        // Add a curve from four control points and return its index
+        size_t Add(
+            const Vec3<T>& p0, const Vec3<T>& p1,
+            const Vec3<T>& p2, const Vec3<T>& p3,
+            CubicBasis basis) {
+            AddComponent(ax, bx, cx, dx, p0.GetX(), p1.GetX(), p2.GetX(), p3.GetX(), basis);
+            AddComponent(ay, by, cy, dy, p0.GetY(), p1.GetY(), p2.GetY(), p3.GetY(), basis);
+            AddComponent(az, bz, cz, dz, p0.GetZ(), p1.GetZ(), p2.GetZ(), p3.GetZ(), basis);
+            arcLengths.resize(arcLengths.size() + ArcLengthSamples + 1);
+            BuildArcLengthTable(ax.size() - 1);
+            return ax.size() - 1;
+        }
+
+        // Get the number of curves
+        size_t Size() const { return ax.size(); }
+
+        // Get the point on a curve at parameter t in [0, 1]
+        Vec3<T> Evaluate(size_t curve, T t) const {
+            return Vec3<T>(
+                ((dx[curve] * t + cx[curve]) * t + bx[curve]) * t + ax[curve],
+                ((dy[curve] * t + cy[curve]) * t + by[curve]) * t + ay[curve],
+                ((dz[curve] * t + cz[curve]) * t + bz[curve]) * t + az[curve]);
+        }
+
+        // Get the derivative of a curve with respect to t
+        Vec3<T> Derivative(size_t curve, T t) const {
+            return Vec3<T>(
+                (3 * dx[curve] * t + 2 * cx[curve]) * t + bx[curve],
+                (3 * dy[curve] * t + 2 * cy[curve]) * t + by[curve],
+                (3 * dz[curve] * t + 2 * cz[curve]) * t + bz[curve]);
+        }
+
+        // Evaluate one curve at count parameters, writing into out
+        void Evaluate(size_t curve, const T* t, Vec3<T>* out, size_t count) const {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = Evaluate(curve, t[index]);
+            }
+        }
+
+        // Evaluate every curve at the same parameter, writing Size() points into out
+        void EvaluateAll(T t, Vec3<T>* out) const {
+            size_t count = Size();
+            for (size_t curve = 0; curve < count; curve++) {
+                out[curve] = Evaluate(curve, t);
+            }
+        }
+
+        // Sample a curve at count evenly spaced parameters from 0 to 1 by
+        // forward differencing, which costs three additions per component
+        void SampleUniform(size_t curve, size_t count, Vec3<T>* out) const {
+            if (count == 0) {
+                return;
+            }
+            if (count == 1) {
+                out[0] = Evaluate(curve, T(0));
+                return;
+            }
+            T h = T(1) / T(count - 1);
+            ForwardDifference x(ax[curve], bx[curve], cx[curve], dx[curve], h);
+            ForwardDifference y(ay[curve], by[curve], cy[curve], dy[curve], h);
+            ForwardDifference z(az[curve], bz[curve], cz[curve], dz[curve], h);
+            for (size_t index = 0; index < count; index++) {
+                out[index] = Vec3<T>(x.value, y.value, z.value);
+                x.Step();
+                y.Step();
+                z.Step();
+            }
+        }
+
+        // Get the approximate arc length of a curve
+        T Length(size_t curve) const {
+            return ArcLengthTable(curve)[ArcLengthSamples];
+        }
+
+        // Get the parameter at which a curve has travelled a given arc length
+        T ParameterAtDistance(size_t curve, T distance) const {
+            const T* table = ArcLengthTable(curve);
+            if (distance <= T(0)) {
+                return T(0);
+            }
+            if (distance >= table[ArcLengthSamples]) {
+                return T(1);
+            }
+            size_t low = 0;
+            size_t high = ArcLengthSamples;
+            while (high - low > 1) {
+                size_t mid = (low + high) / 2;
+                if (table[mid] < distance) {
+                    low = mid;
+                }
+                else {
+                    high = mid;
+                }
+            }
+            T span = table[high] - table[low];
+            T fraction = span > T(0) ? (distance - table[low]) / span : T(0);
+            return (T(low) + fraction) / T(ArcLengthSamples);
+        }
+
+        // Sample a curve at count points evenly spaced by arc length
+        void SampleConstantSpeed(size_t curve, size_t count, Vec3<T>* out) const {
+            if (count == 0) {
+                return;
+            }
+            T length = Length(curve);
+            T step = count > 1 ? length / T(count - 1) : T(0);
+            for (size_t index = 0; index < count; index++) {
+                out[index] = Evaluate(curve, ParameterAtDistance(curve, step * T(index)));
+            }
+        }
+
+    private:
+
+        // Running value and differences of one cubic component at step h
+        struct ForwardDifference {
+
+            ForwardDifference(T a, T b, T c, T d, T h) :
+                value(a),
+                first(((d * h + c) * h + b) * h),
+                second((6 * d * h + 2 * c) * h * h),
+                third(6 * d * h * h * h) {}
+
+            inline void Step() {
+                value += first;
+                first += second;
+                second += third;
+            }
+
+            T value, first, second, third;
+
+        };
+
+        // Append the power form coefficients of one component
+        static void AddComponent(
+            std::vector<T>& a, std::vector<T>& b, std::vector<T>& c, std::vector<T>& d,
+            T p0, T p1, T p2, T p3, CubicBasis basis) {
+            switch (basis) {
+            case CubicBasis::BEZIER:
+                a.push_back(p0);
+                b.push_back(3 * (p1 - p0));
+                c.push_back(3 * (p0 - 2 * p1 + p2));
+                d.push_back(-p0 + 3 * p1 - 3 * p2 + p3);
+                break;
+            case CubicBasis::CATMULL_ROM:
+                a.push_back(p1);
+                b.push_back((p2 - p0) / 2);
+                c.push_back((2 * p0 - 5 * p1 + 4 * p2 - p3) / 2);
+                d.push_back((-p0 + 3 * p1 - 3 * p2 + p3) / 2);
+                break;
+            case CubicBasis::B_SPLINE:
+            default:
+                a.push_back((p0 + 4 * p1 + p2) / 6);
+                b.push_back((p2 - p0) / 2);
+                c.push_back((p0 - 2 * p1 + p2) / 2);
+                d.push_back((-p0 + 3 * p1 - 3 * p2 + p3) / 6);
+                break;
+            }
+        }
+
+        // Fill the cumulative chord lengths of a curve
+        void BuildArcLengthTable(size_t curve) {
+            T* table = &arcLengths[curve * (ArcLengthSamples + 1)];
+            T h = T(1) / T(ArcLengthSamples);
+            ForwardDifference x(ax[curve], bx[curve], cx[curve], dx[curve], h);
+            ForwardDifference y(ay[curve], by[curve], cy[curve], dy[curve], h);
+            ForwardDifference z(az[curve], bz[curve], cz[curve], dz[curve], h);
+            Vec3<T> previous(x.value, y.value, z.value);
+            table[0] = T(0);
+            for (size_t index = 1; index <= ArcLengthSamples; index++) {
+                x.Step();
+                y.Step();
+                z.Step();
+                const Vec3<T> current(x.value, y.value, z.value);
+                table[index] = table[index - 1] + previous.DistanceTo(current);
+                previous = current;
+            }
+        }
+
+        // Get the cumulative chord lengths of a curve
+        const T* ArcLengthTable(size_t curve) const {
+            return &arcLengths[curve * (ArcLengthSamples + 1)];
+        }
+
+        std::vector<T> ax, ay, az;
+        std::vector<T> bx, by, bz;
+        std::vector<T> cx, cy, cz;
+        std::vector<T> dx, dy, dz;
+
+        std::vector<T> arcLengths;
+
+    };
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../Vec2.h"
+#include "../Vec3.h"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace Math {
+
+    namespace Interpolate {
+
+        // Linear interpolation between two Vec2, t = 0 gives from and t = 1 gives to
+        template<typename T>
+        constexpr Vec2<T> Lerp(const Vec2<T>& from, const Vec2<T>& to, T t) {
+            return Vec2<T>(
+                from.GetX() + (to.GetX() - from.GetX()) * t,
+                from.GetY() + (to.GetY() - from.GetY()) * t);
+        }
+
+        // Linear interpolation between two Vec3, t = 0 gives from and t = 1 gives to
+        template<typename T>
+        constexpr Vec3<T> Lerp(const Vec3<T>& from, const Vec3<T>& to, T t) {
+            return Vec3<T>(
+                from.GetX() + (to.GetX() - from.GetX()) * t,
+                from.GetY() + (to.GetY() - from.GetY()) * t,
+                from.GetZ() + (to.GetZ() - from.GetZ()) * t);
+        }
+
+        // Normalized linear interpolation between two Vec2 directions
+        template<typename T>
+        Vec2<T> Nlerp(const Vec2<T>& from, const Vec2<T>& to, T t) {
+            return Lerp(from, to, t).Normalize();
+        }
+
+        // Normalized linear interpolation between two Vec3 directions
+        template<typename T>
+        Vec3<T> Nlerp(const Vec3<T>& from, const Vec3<T>& to, T t) {
+            return Lerp(from, to, t).Normalize();
+        }
+
+        // Batched Lerp of count pairs by one shared t, writing into out. The
+        // arithmetic constraint keeps a non-const t array from binding here
+        // instead of to the per-pair overload.
+        template<typename Point, typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+        void Lerp(const Point* from, const Point* to, T t, Point* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = Lerp(from[index], to[index], t);
+            }
+        }
+
+        // Batched Lerp of count pairs, each by its own t, writing into out
+        template<typename Point, typename T>
+        void Lerp(const Point* from, const Point* to, const T* t, Point* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = Lerp(from[index], to[index], t[index]);
+            }
+        }
+
+        // Batched Nlerp of count pairs by one shared t, writing into out
+        template<typename Point, typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+        void Nlerp(const Point* from, const Point* to, T t, Point* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = Nlerp(from[index], to[index], t);
+            }
+        }
+
+        // Batched Nlerp of count pairs, each by its own t, writing into out
+        template<typename Point, typename T>
+        void Nlerp(const Point* from, const Point* to, const T* t, Point* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = Nlerp(from[index], to[index], t[index]);
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace Math {
+    enum class AsyncError {
+        CANCELLED,
+        UNSPECIFIED
+    };
+}
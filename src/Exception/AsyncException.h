@@ -0,0 +1,32 @@
+#pragma once
+
+#include "MathException.h"
+#include "AsyncError.h"
+
+namespace Math {
+
+    class AsyncException : public MathException {
+
+    public:
+
+        AsyncException(const char* message) : MathException(message) {}
+
+        AsyncException(const std::string& message) : MathException(message) {}
+
+        AsyncException(const AsyncError& error) : MathException(ErrorToString(error)) {}
+
+    private:
+
+        std::string ErrorToString(const AsyncError& error) {
+            switch (error) {
+            case AsyncError::CANCELLED:
+                return "Operation was cancelled";
+            case AsyncError::UNSPECIFIED:
+            default:
+                return "Unspecified Async Error";
+            }
+        }
+
+    };
+
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace Math {
+    enum class FixedError {
+        DIVIDE_BY_ZERO,
+        UNSPECIFIED
+    };
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "MathException.h"
+#include "FixedError.h"
+
+namespace Math {
+
+    class FixedException : public MathException {
+
+    public:
+
+        FixedException(const char* message) : MathException(message) {}
+
+        FixedException(const std::string& message) : MathException(message) {}
+
+        FixedException(const FixedError& error) : MathException(ErrorToString(error)) {}
+
+    private:
+
+        std::string ErrorToString(const FixedError& error) {
+            switch (error) {
+            case FixedError::DIVIDE_BY_ZERO:
+                return "Fixed division by zero";
+            case FixedError::UNSPECIFIED:
+            default:
+                return "Unspecified Fixed Error";
+            }
+        }
+
+    };
+
+}
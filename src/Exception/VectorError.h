@@ -3,6 +3,8 @@
 namespace Math {
     enum class VectorError {
         NORMALIZE_ZERO,
+        PROJECT_ZERO,
+        SIZE_MISMATCH,
         UNSPECIFIED
     };
 }
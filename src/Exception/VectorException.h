@@ -21,6 +21,10 @@ namespace Math {
             switch (error) {
             case VectorError::NORMALIZE_ZERO:
                 return "Cannot normalize the zero vector";
+            case VectorError::PROJECT_ZERO:
+                return "Cannot project onto the zero vector";
+            case VectorError::SIZE_MISMATCH:
+                return "Number of values does not match the vector size";
             case VectorError::UNSPECIFIED:
             default:
                 return "Unspecified Vector Error";
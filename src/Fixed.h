@@ -0,0 +1,258 @@
+#pragma once
+
+#include "Exception/FixedException.h"
+#include "Scalar.h"
+
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+namespace Math {
+
+    // 64-bit fixed point arithmetic needs 128-bit intermediates. Compilers
+    // with a 128-bit integer type use it, everywhere else (including MSVC)
+    // the products are split into 32-bit halves, so Fixed behaves the same
+    // on every platform.
+    namespace Detail {
+
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef __int128 Int128;
+        __extension__ typedef unsigned __int128 UInt128;
+#endif
+
+        // Full product of two 64-bit integers as high and low words
+        constexpr void MultiplyWide(uint64_t first, uint64_t second, uint64_t& high, uint64_t& low) {
+#if defined(__SIZEOF_INT128__)
+            UInt128 product = UInt128(first) * second;
+            high = uint64_t(product >> 64);
+            low = uint64_t(product);
+#else
+            uint64_t lowLow = (first & 0xFFFFFFFFu) * (second & 0xFFFFFFFFu);
+            uint64_t highLow = (first >> 32) * (second & 0xFFFFFFFFu);
+            uint64_t lowHigh = (first & 0xFFFFFFFFu) * (second >> 32);
+            uint64_t highHigh = (first >> 32) * (second >> 32);
+            uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + (lowHigh & 0xFFFFFFFFu);
+            high = highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+            low = (middle << 32) | (lowLow & 0xFFFFFFFFu);
+#endif
+        }
+
+        // (first * second) >> shift computed at full width, rounded toward
+        // negative infinity and wrapped to 64 bits. Neither path branches on
+        // the signs, so batched loops stay free of data dependent jumps.
+        constexpr int64_t MultiplyShift(int64_t first, int64_t second, int shift) {
+#if defined(__SIZEOF_INT128__)
+            return int64_t(uint64_t(UInt128(Int128(first) * second >> shift)));
+#else
+            uint64_t high = 0;
+            uint64_t low = 0;
+            MultiplyWide(uint64_t(first), uint64_t(second), high, low);
+            // Correct the unsigned product to the signed one, masking with
+            // the sign of each factor instead of testing it
+            high -= uint64_t(second) & uint64_t(first >> 63);
+            high -= uint64_t(first) & uint64_t(second >> 63);
+            return shift == 0 ? int64_t(low) : int64_t((low >> shift) | (high << (64 - shift)));
+#endif
+        }
+
+        // (dividend << shift) / divisor computed at full width, rounded
+        // toward zero and wrapped to 64 bits
+        constexpr int64_t ShiftDivide(int64_t dividend, int64_t divisor, int shift) {
+            bool negative = (dividend < 0) != (divisor < 0);
+            uint64_t magnitude = dividend < 0 ? 0 - uint64_t(dividend) : uint64_t(dividend);
+            uint64_t denominator = divisor < 0 ? 0 - uint64_t(divisor) : uint64_t(divisor);
+#if defined(__SIZEOF_INT128__)
+            uint64_t quotient = uint64_t((UInt128(magnitude) << shift) / denominator);
+#else
+            // Restoring division, one bit of the 128-bit dividend at a time
+            uint64_t high = shift == 0 ? 0 : magnitude >> (64 - shift);
+            uint64_t low = magnitude << shift;
+            uint64_t remainder = 0;
+            uint64_t quotient = 0;
+            for (int bit = 127; bit >= 0; bit--) {
+                bool carry = (remainder >> 63) != 0;
+                remainder = (remainder << 1) | ((bit >= 64 ? high >> (bit - 64) : low >> bit) & 1u);
+                quotient <<= 1;
+                if (carry || remainder >= denominator) {
+                    remainder -= denominator;
+                    quotient |= 1u;
+                }
+            }
+#endif
+            return int64_t(negative ? 0 - quotient : quotient);
+        }
+
+        // Floor of the square root of value << shift
+        constexpr uint64_t ShiftSqrt(uint64_t value, int shift) {
+#if defined(__SIZEOF_INT128__)
+            return uint64_t(ISqrt(UInt128(value) << shift));
+#else
+            uint64_t high = shift == 0 ? 0 : value >> (64 - shift);
+            uint64_t low = value << shift;
+            uint64_t result = 0;
+            for (int bit = 63; bit >= 0; bit--) {
+                uint64_t candidate = result | (uint64_t(1) << bit);
+                uint64_t squareHigh = 0;
+                uint64_t squareLow = 0;
+                MultiplyWide(candidate, candidate, squareHigh, squareLow);
+                if (squareHigh < high || (squareHigh == high && squareLow <= low)) {
+                    result = candidate;
+                }
+            }
+            return result;
+#endif
+        }
+
+    }
+
+    // Signed fixed point number with IntBits integer bits (including the
+    // sign) and FracBits fractional bits. Every operation is exact integer
+    // arithmetic, so results are identical on every machine, which is what
+    // lockstep simulations need. Fixed can be used as T in Vec2, Vec3, Vec,
+    // Mat2, Mat3 and Mat. Multiplication and division truncate toward
+    // negative infinity and zero respectively, overflow wraps and division
+    // by zero throws a FixedException.
+    template<int IntBits, int FracBits>
+    class Fixed {
+
+    public:
+
+        static_assert(IntBits + FracBits <= 64, "Fixed supports at most 64 bits");
+        static_assert(IntBits > 0 && FracBits >= 0, "Fixed needs a sign bit");
+
+        // Integer type holding the raw value
+        using Raw = std::conditional_t<(IntBits + FracBits <= 32), int32_t, int64_t>;
+
+        static constexpr Raw One = Raw(1) << FracBits;
+
+        // Empty constructor, zero
+        constexpr Fixed() : raw(0) {}
+
+        // Construct from an integer
+        constexpr Fixed(int value) : raw(Raw(UnsignedRaw(Raw(value)) << FracBits)) {}
+
+        // Construct from a floating point value, rounded to the nearest step
+        constexpr explicit Fixed(double value) :
+            raw(Raw(value * double(One) + (value < 0 ? -0.5 : 0.5))) {}
+
+        // Copy constructor
+        constexpr Fixed(const Fixed& other) = default;
+
+        // Move contstructor
+        constexpr Fixed(Fixed&& other) = default;
+
+        // Destructor
+        ~Fixed() = default;
+
+        // Copy assignment
+        constexpr Fixed& operator=(const Fixed& other) = default;
+
+        // Move assignment
+        constexpr Fixed& operator=(Fixed&& other) = default;
+
+        // Construct from a raw value, which is the number times 2^FracBits
+        static constexpr Fixed FromRaw(Raw raw) {
+            Fixed result;
+            result.raw = raw;
+            return result;
+        }
+
+        // Get the raw value, which is the number times 2^FracBits
+        constexpr Raw GetRaw() const { return raw; }
+
+        // Convert to a floating point value
+        constexpr explicit operator double() const { return double(raw) / double(One); }
+
+        // Convert to an integer, truncating toward negative infinity
+        constexpr explicit operator int() const { return int(raw >> FracBits); }
+
+        constexpr Fixed operator-() const { return FromRaw(Raw(UnsignedRaw(0) - UnsignedRaw(raw))); }
+
+        constexpr Fixed& operator+=(const Fixed& other) {
+            raw = Raw(UnsignedRaw(raw) + UnsignedRaw(other.raw));
+            return *this;
+        }
+
+        constexpr Fixed& operator-=(const Fixed& other) {
+            raw = Raw(UnsignedRaw(raw) - UnsignedRaw(other.raw));
+            return *this;
+        }
+
+        constexpr Fixed& operator*=(const Fixed& other) {
+            if constexpr (sizeof(Raw) == 4) {
+                raw = Raw((int64_t(raw) * int64_t(other.raw)) >> FracBits);
+            }
+            else {
+                raw = Detail::MultiplyShift(raw, other.raw, FracBits);
+            }
+            return *this;
+        }
+
+        constexpr Fixed& operator/=(const Fixed& other) {
+            if (other.raw == 0) {
+                throw FixedException(FixedError::DIVIDE_BY_ZERO);
+            }
+            if constexpr (sizeof(Raw) == 4) {
+                raw = Raw((int64_t(raw) * int64_t(One)) / int64_t(other.raw));
+            }
+            else {
+                raw = Detail::ShiftDivide(raw, other.raw, FracBits);
+            }
+            return *this;
+        }
+
+        friend constexpr Fixed operator+(Fixed first, const Fixed& second) { return first += second; }
+
+        friend constexpr Fixed operator-(Fixed first, const Fixed& second) { return first -= second; }
+
+        friend constexpr Fixed operator*(Fixed first, const Fixed& second) { return first *= second; }
+
+        friend constexpr Fixed operator/(Fixed first, const Fixed& second) { return first /= second; }
+
+        friend constexpr bool operator==(const Fixed& first, const Fixed& second) { return first.raw == second.raw; }
+
+        friend constexpr bool operator!=(const Fixed& first, const Fixed& second) { return first.raw != second.raw; }
+
+        friend constexpr bool operator<(const Fixed& first, const Fixed& second) { return first.raw < second.raw; }
+
+        friend constexpr bool operator<=(const Fixed& first, const Fixed& second) { return first.raw <= second.raw; }
+
+        friend constexpr bool operator>(const Fixed& first, const Fixed& second) { return first.raw > second.raw; }
+
+        friend constexpr bool operator>=(const Fixed& first, const Fixed& second) { return first.raw >= second.raw; }
+
+        // Exact floor square root, negative values give 0
+        friend constexpr Fixed Sqrt(const Fixed& value) {
+            if (value.raw <= 0) {
+                return Fixed();
+            }
+            if constexpr (sizeof(Raw) == 4) {
+                return FromRaw(Raw(ISqrt(uint64_t(value.raw) << FracBits)));
+            }
+            else {
+                return FromRaw(Raw(Detail::ShiftSqrt(uint64_t(value.raw), FracBits)));
+            }
+        }
+
+        // Reciprocal square root, 1 / Sqrt(value), throws for values whose
+        // square root is zero
+        friend constexpr Fixed Rsqrt(const Fixed& value) {
+            return Fixed(1) / Sqrt(value);
+        }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(
+            std::ostream& stream, const Fixed& value) {
+            stream << double(value);
+            return stream;
+        }
+
+    private:
+
+        using UnsignedRaw = std::make_unsigned_t<Raw>;
+
+        Raw raw;
+
+    };
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Fixed.h"
+#include "Vec3.h"
+
+#include <cstddef>
+
+namespace Math {
+
+    // Batched Fixed arithmetic over arrays. The Fixed operators inline to
+    // plain integer arithmetic on the raw values, and since integer addition
+    // is associative the results do not depend on how the compiler
+    // vectorizes the loops. Add vectorizes for every format and instruction
+    // set. Scale and Dot of formats up to 32 bits widen each product to 64
+    // bits, which vectorizes with AVX2 (see the avx2 variant) but not with
+    // plain SSE2. Wider formats need 128-bit products that no SIMD unit
+    // has, so their Scale and Dot stay scalar, without branches.
+    namespace FixedKernels {
+
+        // out[i] = first[i] + second[i]
+        template<int I, int F>
+        void Add(const Fixed<I, F>* first, const Fixed<I, F>* second, Fixed<I, F>* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = first[index] + second[index];
+            }
+        }
+
+        // out[i] = in[i] * scalar
+        template<int I, int F>
+        void Scale(const Fixed<I, F>* in, Fixed<I, F> scalar, Fixed<I, F>* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = in[index] * scalar;
+            }
+        }
+
+        // Dot product of two arrays. Each product is rounded like
+        // Fixed::operator*, so the result is bit-identical to summing the
+        // Fixed products one by one.
+        template<int I, int F>
+        Fixed<I, F> Dot(const Fixed<I, F>* first, const Fixed<I, F>* second, size_t count) {
+            Fixed<I, F> sum;
+            for (size_t index = 0; index < count; index++) {
+                sum += first[index] * second[index];
+            }
+            return sum;
+        }
+
+        // out[i] = dot product of first[i] and second[i] for count Vec3 pairs,
+        // bit-identical to Vec3::Dot
+        template<int I, int F>
+        void Dot(const Vec3<Fixed<I, F>>* first, const Vec3<Fixed<I, F>>* second, Fixed<I, F>* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = first[index].GetX() * second[index].GetX()
+                    + first[index].GetY() * second[index].GetY()
+                    + first[index].GetZ() * second[index].GetZ();
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "../Vec3.h"
+
+#include <algorithm>
+#include <ostream>
+
+namespace Math {
+
+    template<typename T>
+    class AABB3 {
+
+    public:
+
+        // Empty constructor
+        AABB3() = delete;
+
+        // Default constructor, corners are reordered so min <= max on every axis
+        constexpr AABB3(const Vec3<T>& first, const Vec3<T>& second) :
+            min(
+                std::min(first.GetX(), second.GetX()),
+                std::min(first.GetY(), second.GetY()),
+                std::min(first.GetZ(), second.GetZ())),
+            max(
+                std::max(first.GetX(), second.GetX()),
+                std::max(first.GetY(), second.GetY()),
+                std::max(first.GetZ(), second.GetZ())) {}
+
+        // Copy constructor
+        constexpr AABB3(const AABB3<T>& other) = default;
+
+        // Move contstructor
+        constexpr AABB3(AABB3&& other) = default;
+
+        // Destructor
+        ~AABB3() = default;
+
+        // Copy assignment
+        constexpr AABB3& operator=(const AABB3& other) = default;
+
+        // Move assignment
+        constexpr AABB3& operator=(AABB3&& other) = default;
+
+        // Check whether a point lies inside or on the boundary of this box
+        constexpr bool Contains(const Vec3<T>& point) const {
+            return point.GetX() >= min.GetX() && point.GetX() <= max.GetX()
+                && point.GetY() >= min.GetY() && point.GetY() <= max.GetY()
+                && point.GetZ() >= min.GetZ() && point.GetZ() <= max.GetZ();
+        }
+
+        // Check whether this box overlaps another box
+        constexpr bool Overlaps(const AABB3<T>& other) const {
+            return min.GetX() <= other.max.GetX() && max.GetX() >= other.min.GetX()
+                && min.GetY() <= other.max.GetY() && max.GetY() >= other.min.GetY()
+                && min.GetZ() <= other.max.GetZ() && max.GetZ() >= other.min.GetZ();
+        }
+
+        // Get the center point of this box
+        constexpr Vec3<T> Center() const {
+            return Vec3<T>(
+                (min.GetX() + max.GetX()) / 2,
+                (min.GetY() + max.GetY()) / 2,
+                (min.GetZ() + max.GetZ()) / 2);
+        }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(
+            std::ostream& stream, const AABB3<T>& box) {
+            stream << "[" << box.min << ", " << box.max << "]";
+            return stream;
+        }
+
+        constexpr const Vec3<T>& GetMin() const { return min; }
+
+        constexpr const Vec3<T>& GetMax() const { return max; }
+
+    private:
+
+        Vec3<T> min, max;
+
+    };
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "AABB3.h"
+#include "HitResult.h"
+#include "IntersectKernels.h"
+#include "Ray3.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Math {
+
+    // N boxes stored component-wise (SoA) so one ray can be tested against all
+    // of them in a single vectorized pass. Typical sizes are 4, 8 and 16.
+    template<typename T, size_t N>
+    class AABB3Batch {
+
+    public:
+
+        static_assert(N <= 32, "AABB3Batch supports at most 32 lanes");
+
+        // Empty constructor, every lane starts unused
+        AABB3Batch() = default;
+
+        // Store a box in lane index
+        void Set(size_t index, const AABB3<T>& box) {
+            minX[index] = box.GetMin().GetX();
+            minY[index] = box.GetMin().GetY();
+            minZ[index] = box.GetMin().GetZ();
+            maxX[index] = box.GetMax().GetX();
+            maxY[index] = box.GetMax().GetY();
+            maxZ[index] = box.GetMax().GetZ();
+            used |= uint32_t(1) << index;
+        }
+
+        // Get the box in lane index
+        AABB3<T> Get(size_t index) const {
+            return AABB3<T>(
+                Vec3<T>(minX[index], minY[index], minZ[index]),
+                Vec3<T>(maxX[index], maxY[index], maxZ[index]));
+        }
+
+        // Intersect one ray with every box, unused lanes never hit
+        HitResult<T, N> Intersect(const Ray3<T>& ray) const {
+            const auto& origin = ray.GetOrigin();
+            const auto& inverse = ray.GetInverseDirection();
+            T ox = origin.GetX(), oy = origin.GetY(), oz = origin.GetZ();
+            T ix = inverse.GetX(), iy = inverse.GetY(), iz = inverse.GetZ();
+            // The ray's direction is shared by all lanes, so pick the near and
+            // far bounds once instead of per lane
+            const auto& nearX = ix >= T(0) ? minX : maxX;
+            const auto& nearY = iy >= T(0) ? minY : maxY;
+            const auto& nearZ = iz >= T(0) ? minZ : maxZ;
+            const auto& farX = ix >= T(0) ? maxX : minX;
+            const auto& farY = iy >= T(0) ? maxY : minY;
+            const auto& farZ = iz >= T(0) ? maxZ : minZ;
+            return HitResult<T, N>::Collect(used, [&](size_t lane, T& distance) {
+                return IntersectKernels::RayBox(
+                    ox, oy, oz, ix, iy, iz,
+                    nearX[lane], nearY[lane], nearZ[lane],
+                    farX[lane], farY[lane], farZ[lane],
+                    distance);
+            });
+        }
+
+    private:
+
+        std::array<T, N> minX{}, minY{}, minZ{};
+        std::array<T, N> maxX{}, maxY{}, maxZ{};
+        uint32_t used = 0;
+
+    };
+
+}
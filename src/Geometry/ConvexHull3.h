@@ -0,0 +1,426 @@
+#pragma once
+
+#include "Predicates.h"
+#include "../Async/Async.h"
+#include "../Async/ThreadPool.h"
+#include "../Mat3.h"
+#include "../Vec2.h"
+#include "../Vec3.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Math {
+
+    // Convex hull of a 3D point set by incremental construction with
+    // conflict lists (Quickhull). Every face keeps an intrusive list of the
+    // points outside it; the furthest of them is added next, the faces it
+    // sees are replaced by a cone over their horizon, and only their points
+    // are handed on to the new faces. Visibility uses the exact Orient3D
+    // predicate, so coplanar and nearly coplanar input cannot break the mesh.
+    // Buffers are kept between calls, so no memory is allocated per point.
+    // Given a ThreadPool the initial partition of the points, which discards
+    // most interior points, runs in parallel.
+    template<typename T>
+    class ConvexHull3 {
+
+    public:
+
+        static_assert(std::is_floating_point_v<T>, "ConvexHull3 needs floating point points");
+
+        // Empty constructor, runs on the calling thread
+        ConvexHull3() = default;
+
+        // Pool constructor, the initial partition is split across the pool
+        explicit ConvexHull3(ThreadPool& pool) : pool(&pool) {}
+
+        // Copy constructor
+        ConvexHull3(const ConvexHull3<T>& other) = default;
+
+        // Move contstructor
+        ConvexHull3(ConvexHull3&& other) = default;
+
+        // Destructor
+        ~ConvexHull3() = default;
+
+        // Copy assignment
+        ConvexHull3& operator=(const ConvexHull3& other) = default;
+
+        // Move assignment
+        ConvexHull3& operator=(ConvexHull3&& other) = default;
+
+        // Build the hull of count points. Returns three point indices per
+        // triangle, counter-clockwise seen from outside. Points inside the
+        // hull are not used. A point on the final surface becomes a vertex
+        // when it lay outside the hull built so far, and coplanar faces are
+        // not merged, so a flat side may be split into more triangles than
+        // it needs. The buffer is empty when all points are coplanar.
+        const std::vector<uint32_t>& Build(const Vec3<T>* points, size_t count) {
+            this->points = points;
+            triangles.clear();
+            faces.clear();
+            unused.clear();
+            pending.clear();
+            if (count < 4 || !Seed(count)) {
+                return triangles;
+            }
+            Partition(count);
+            while (!pending.empty()) {
+                uint32_t face = pending.back();
+                pending.pop_back();
+                if (faces[face].vertices[0] != Unused && faces[face].head != None) {
+                    Add(face);
+                }
+            }
+            for (const Face& face : faces) {
+                if (face.vertices[0] != Unused) {
+                    triangles.insert(triangles.end(), face.vertices, face.vertices + 3);
+                }
+            }
+            return triangles;
+        }
+
+        // Get the triangles of the last hull
+        const std::vector<uint32_t>& GetTriangles() const { return triangles; }
+
+    private:
+
+        // End of a conflict list, or no face
+        static constexpr uint32_t None = UINT32_MAX;
+
+        // Marks a face slot that is free for reuse
+        static constexpr uint32_t Unused = UINT32_MAX - 1;
+
+        // Number of items each parallel task handles
+        static constexpr size_t Grain = 16384;
+
+        // Neighbor i lies across the edge from vertex i to vertex i + 1
+        struct Face {
+            uint32_t vertices[3];
+            uint32_t neighbors[3];
+            // Conflict list and its point furthest from the face
+            uint32_t head;
+            uint32_t furthest;
+            double distance;
+        };
+
+        // Edge of the visible region, from first to second on the face that is kept
+        struct Edge {
+            uint32_t first, second, outside;
+        };
+
+        // Run body(begin, end) over [0, count), on the pool when there is one
+        template<typename Body>
+        void For(size_t count, const Body& body) const {
+            if (pool == nullptr || count <= Grain) {
+                body(0, count);
+                return;
+            }
+            Async::Options options;
+            options.pool = pool;
+            options.grain = Grain;
+            auto done = Async::ParallelFor(count, body, options);
+            pool->Wait(done);
+        }
+
+        // Build the first tetrahedron from extreme points
+        bool Seed(size_t count) {
+            // Two extremes along the axis with the largest extent
+            uint32_t extremes[3][2] = { { 0, 0 }, { 0, 0 }, { 0, 0 } };
+            for (uint32_t index = 1; index < count; index++) {
+                for (int axis = 0; axis < 3; axis++) {
+                    if (Coordinate(index, axis) < Coordinate(extremes[axis][0], axis)) {
+                        extremes[axis][0] = index;
+                    }
+                    if (Coordinate(index, axis) > Coordinate(extremes[axis][1], axis)) {
+                        extremes[axis][1] = index;
+                    }
+                }
+            }
+            int axis = 0;
+            T extent = T(-1);
+            for (int candidate = 0; candidate < 3; candidate++) {
+                T size = Coordinate(extremes[candidate][1], candidate) - Coordinate(extremes[candidate][0], candidate);
+                if (size > extent) {
+                    extent = size;
+                    axis = candidate;
+                }
+            }
+            if (extent <= T(0)) {
+                return false;
+            }
+            uint32_t a = extremes[axis][0], b = extremes[axis][1];
+
+            // The point furthest from the line, then from the plane, checked exactly
+            const Vec3<double> ab = Difference(b, a);
+            uint32_t c = Furthest(count, [&](uint32_t index) {
+                const Vec3<double> cross = ab.Cross(Difference(index, a));
+                return cross.Dot(cross);
+            });
+            if (Collinear(a, b, c)) {
+                c = None;
+                for (uint32_t index = 0; index < count && c == None; index++) {
+                    c = Collinear(a, b, index) ? None : index;
+                }
+                if (c == None) {
+                    return false;
+                }
+            }
+            const Vec3<double> normal = ab.Cross(Difference(c, a));
+            uint32_t d = Furthest(count, [&](uint32_t index) {
+                double height = normal.Dot(Difference(index, a));
+                return height * height;
+            });
+            if (Orient(a, b, c, d) == 0) {
+                d = None;
+                for (uint32_t index = 0; index < count && d == None; index++) {
+                    d = Orient(a, b, c, index) == 0 ? None : index;
+                }
+                if (d == None) {
+                    return false;
+                }
+            }
+            if (Orient(a, b, c, d) < 0) {
+                std::swap(b, c);
+            }
+
+            // d lies below (a, b, c), so these are counter-clockwise from outside
+            faces.push_back(MakeFace(a, b, c, { 1, 2, 3 }));
+            faces.push_back(MakeFace(a, d, b, { 3, 2, 0 }));
+            faces.push_back(MakeFace(b, d, c, { 1, 3, 0 }));
+            faces.push_back(MakeFace(c, d, a, { 2, 1, 0 }));
+            seeds[0] = a;
+            seeds[1] = b;
+            seeds[2] = c;
+            seeds[3] = d;
+            visits.assign(4, 0);
+            starts.resize(count);
+            next.resize(count);
+            epoch = 0;
+            return true;
+        }
+
+        // Give every point outside the tetrahedron to the first face it sees
+        void Partition(size_t count) {
+            owners.resize(count);
+            heights.resize(count);
+            For(count, [&](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; index++) {
+                    owners[index] = None;
+                    uint32_t point = uint32_t(index);
+                    if (point == seeds[0] || point == seeds[1] || point == seeds[2] || point == seeds[3]) {
+                        continue;
+                    }
+                    for (uint32_t face = 0; face < 4; face++) {
+                        if (Sees(face, point)) {
+                            owners[index] = face;
+                            heights[index] = Height(face, point);
+                            break;
+                        }
+                    }
+                }
+            });
+            for (uint32_t point = 0; point < count; point++) {
+                if (owners[point] != None) {
+                    Push(owners[point], point, heights[point]);
+                }
+            }
+            for (uint32_t face = 0; face < 4; face++) {
+                if (faces[face].head != None) {
+                    pending.push_back(face);
+                }
+            }
+        }
+
+        // Add the furthest point of the face's conflict list to the hull
+        void Add(uint32_t start) {
+            uint32_t point = faces[start].furthest;
+
+            // Collect the faces the point sees and the horizon around them
+            epoch++;
+            visible.clear();
+            horizon.clear();
+            stack.clear();
+            stack.push_back(start);
+            visits[start] = epoch;
+            while (!stack.empty()) {
+                uint32_t current = stack.back();
+                stack.pop_back();
+                visible.push_back(current);
+                for (int side = 0; side < 3; side++) {
+                    uint32_t neighbor = faces[current].neighbors[side];
+                    if (visits[neighbor] == epoch) {
+                        continue;
+                    }
+                    if (Sees(neighbor, point)) {
+                        visits[neighbor] = epoch;
+                        stack.push_back(neighbor);
+                    }
+                    else {
+                        const Face& face = faces[current];
+                        horizon.push_back(Edge{ face.vertices[side], face.vertices[(side + 1) % 3], neighbor });
+                    }
+                }
+            }
+
+            // Replace them with a cone from the point over the horizon. The
+            // removed slots are only reused once their points are handed on.
+            created.clear();
+            for (const Edge& edge : horizon) {
+                uint32_t slot = Allocate();
+                faces[slot] = MakeFace(edge.first, edge.second, point, { edge.outside, None, None });
+                Face& outside = faces[edge.outside];
+                for (int side = 0; side < 3; side++) {
+                    if (outside.vertices[side] == edge.second && outside.vertices[(side + 1) % 3] == edge.first) {
+                        outside.neighbors[side] = slot;
+                    }
+                }
+                starts[edge.first] = slot;
+                created.push_back(slot);
+            }
+            // The edge from the point to b is shared with the face built on the horizon edge starting at b
+            for (const Edge& edge : horizon) {
+                uint32_t self = starts[edge.first];
+                uint32_t following = starts[edge.second];
+                faces[self].neighbors[1] = following;
+                faces[following].neighbors[2] = self;
+            }
+
+            // Hand the conflict points of the removed faces to the new ones
+            for (uint32_t face : visible) {
+                uint32_t current = faces[face].head;
+                while (current != None) {
+                    uint32_t following = next[current];
+                    if (current != point) {
+                        for (uint32_t candidate : created) {
+                            if (Sees(candidate, current)) {
+                                Push(candidate, current, Height(candidate, current));
+                                break;
+                            }
+                        }
+                    }
+                    current = following;
+                }
+                faces[face].vertices[0] = Unused;
+                unused.push_back(face);
+            }
+            for (uint32_t face : created) {
+                if (faces[face].head != None) {
+                    pending.push_back(face);
+                }
+            }
+        }
+
+        Face MakeFace(uint32_t a, uint32_t b, uint32_t c, std::array<uint32_t, 3> neighbors) const {
+            return Face{ { a, b, c }, { neighbors[0], neighbors[1], neighbors[2] }, None, None, 0.0 };
+        }
+
+        uint32_t Allocate() {
+            if (!unused.empty()) {
+                uint32_t slot = unused.back();
+                unused.pop_back();
+                return slot;
+            }
+            faces.push_back(MakeFace(Unused, Unused, Unused, { None, None, None }));
+            visits.push_back(0);
+            return uint32_t(faces.size() - 1);
+        }
+
+        // Add a point to the face's conflict list
+        void Push(uint32_t face, uint32_t point, double height) {
+            Face& target = faces[face];
+            next[point] = target.head;
+            target.head = point;
+            if (target.furthest == None || height > target.distance) {
+                target.furthest = point;
+                target.distance = height;
+            }
+        }
+
+        // Whether the point lies strictly outside the face
+        bool Sees(uint32_t face, uint32_t point) const {
+            const Face& target = faces[face];
+            return Orient(target.vertices[0], target.vertices[1], target.vertices[2], point) < 0;
+        }
+
+        // Distance of the point above the face, scaled by twice the face area
+        double Height(uint32_t face, uint32_t point) const {
+            const Face& target = faces[face];
+            Vec3<double> a = Difference(target.vertices[0], point);
+            Vec3<double> b = Difference(target.vertices[1], point);
+            Vec3<double> c = Difference(target.vertices[2], point);
+            return -Mat3<double>(
+                a.GetX(), a.GetY(), a.GetZ(),
+                b.GetX(), b.GetY(), b.GetZ(),
+                c.GetX(), c.GetY(), c.GetZ()).Determinant();
+        }
+
+        // Index maximizing the measure over every point
+        template<typename Measure>
+        uint32_t Furthest(size_t count, const Measure& measure) const {
+            uint32_t best = 0;
+            double bestValue = -1.0;
+            for (uint32_t index = 0; index < count; index++) {
+                double value = measure(index);
+                if (value > bestValue) {
+                    bestValue = value;
+                    best = index;
+                }
+            }
+            return best;
+        }
+
+        // Three points are collinear exactly when all three projections are
+        bool Collinear(uint32_t a, uint32_t b, uint32_t c) const {
+            for (int axis = 0; axis < 3; axis++) {
+                int first = (axis + 1) % 3, second = (axis + 2) % 3;
+                if (Predicates::Orient2D(
+                    Vec2<T>(Coordinate(a, first), Coordinate(a, second)),
+                    Vec2<T>(Coordinate(b, first), Coordinate(b, second)),
+                    Vec2<T>(Coordinate(c, first), Coordinate(c, second))) != 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        Vec3<double> Difference(uint32_t a, uint32_t b) const {
+            return Vec3<double>(
+                double(points[a].GetX()) - double(points[b].GetX()),
+                double(points[a].GetY()) - double(points[b].GetY()),
+                double(points[a].GetZ()) - double(points[b].GetZ()));
+        }
+
+        T Coordinate(uint32_t index, int axis) const {
+            return axis == 0 ? points[index].GetX() : axis == 1 ? points[index].GetY() : points[index].GetZ();
+        }
+
+        int Orient(uint32_t a, uint32_t b, uint32_t c, uint32_t d) const {
+            return Predicates::Orient3D(points[a], points[b], points[c], points[d]);
+        }
+
+        ThreadPool* pool = nullptr;
+        const Vec3<T>* points = nullptr;
+        std::vector<uint32_t> triangles;
+        std::vector<Face> faces;
+        std::vector<uint32_t> unused;
+        std::vector<uint32_t> pending;
+        std::vector<uint32_t> visits;
+        std::vector<uint32_t> starts;
+        std::vector<uint32_t> next;
+        std::vector<uint32_t> owners;
+        std::vector<double> heights;
+        std::vector<uint32_t> visible;
+        std::vector<uint32_t> stack;
+        std::vector<uint32_t> created;
+        std::vector<Edge> horizon;
+        uint32_t seeds[4] = { 0, 0, 0, 0 };
+        uint32_t epoch = 0;
+
+    };
+
+}
@@ -0,0 +1,401 @@
+#pragma once
+
+#include "Predicates.h"
+#include "../Async/Async.h"
+#include "../Async/ThreadPool.h"
+#include "../Vec2.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace Math {
+
+    // Incremental Delaunay triangulation of a 2D point set. Points are
+    // inserted in Hilbert curve order, each one located by walking from the
+    // previous insertion and added by replacing the triangles whose
+    // circumcircle contains it (Bowyer-Watson). The convex hull is closed by
+    // ghost triangles joined to a vertex at infinity, so points outside the
+    // current hull need no special case and no bounding triangle distorts the
+    // result. All decisions use the exact predicates. Buffers are kept between
+    // calls, so no memory is allocated per point. Given a ThreadPool the
+    // Hilbert keys are computed in parallel; insertion itself is sequential.
+    template<typename T>
+    class Delaunay2 {
+
+    public:
+
+        static_assert(std::is_floating_point_v<T>, "Delaunay2 needs floating point points");
+
+        // Empty constructor, runs on the calling thread
+        Delaunay2() = default;
+
+        // Pool constructor, point ordering is split across the pool
+        explicit Delaunay2(ThreadPool& pool) : pool(&pool) {}
+
+        // Copy constructor
+        Delaunay2(const Delaunay2<T>& other) = default;
+
+        // Move contstructor
+        Delaunay2(Delaunay2&& other) = default;
+
+        // Destructor
+        ~Delaunay2() = default;
+
+        // Copy assignment
+        Delaunay2& operator=(const Delaunay2& other) = default;
+
+        // Move assignment
+        Delaunay2& operator=(Delaunay2&& other) = default;
+
+        // Triangulate count points. Returns three point indices per triangle,
+        // counter-clockwise. Repeated points are used once. The buffer is
+        // empty when all points are collinear.
+        const std::vector<uint32_t>& Triangulate(const Vec2<T>* points, size_t count) {
+            this->points = points;
+            triangles.clear();
+            hull.clear();
+            mesh.clear();
+            unused.clear();
+            if (count < 3) {
+                return triangles;
+            }
+            Order(count);
+            if (!Seed(count)) {
+                return triangles;
+            }
+            for (size_t index = 3; index < count; index++) {
+                Insert(order[index]);
+            }
+            Output(count);
+            return triangles;
+        }
+
+        // Get the triangles of the last triangulation
+        const std::vector<uint32_t>& GetTriangles() const { return triangles; }
+
+        // Get the convex hull of the last triangulation as point indices in
+        // counter-clockwise order. Collinear points on hull edges are included.
+        const std::vector<uint32_t>& GetHull() const { return hull; }
+
+    private:
+
+        // Index of the vertex at infinity
+        static constexpr uint32_t Infinite = UINT32_MAX;
+
+        // Marks a triangle slot that is free for reuse
+        static constexpr uint32_t Unused = UINT32_MAX - 1;
+
+        // Number of items each parallel task handles
+        static constexpr size_t Grain = 16384;
+
+        // Neighbor i lies across the edge opposite vertex i
+        struct Triangle {
+            uint32_t vertices[3];
+            uint32_t neighbors[3];
+        };
+
+        // Edge of the cavity: the kept triangle outside it and the new triangle's first two vertices
+        struct Edge {
+            uint32_t first, second, outside;
+        };
+
+        // Run body(begin, end) over [0, count), on the pool when there is one
+        template<typename Body>
+        void For(size_t count, const Body& body) const {
+            if (pool == nullptr || count <= Grain) {
+                body(0, count);
+                return;
+            }
+            Async::Options options;
+            options.pool = pool;
+            options.grain = Grain;
+            auto done = Async::ParallelFor(count, body, options);
+            pool->Wait(done);
+        }
+
+        // Sort the points along a Hilbert curve over their bounding box so
+        // consecutive insertions are close and each walk is short
+        void Order(size_t count) {
+            T minX = points[0].GetX(), maxX = minX, minY = points[0].GetY(), maxY = minY;
+            for (size_t index = 1; index < count; index++) {
+                minX = std::min(minX, points[index].GetX());
+                maxX = std::max(maxX, points[index].GetX());
+                minY = std::min(minY, points[index].GetY());
+                maxY = std::max(maxY, points[index].GetY());
+            }
+            T scaleX = maxX > minX ? T(65535) / (maxX - minX) : T(0);
+            T scaleY = maxY > minY ? T(65535) / (maxY - minY) : T(0);
+            keys.resize(count);
+            For(count, [&](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; index++) {
+                    uint32_t x = uint32_t((points[index].GetX() - minX) * scaleX);
+                    uint32_t y = uint32_t((points[index].GetY() - minY) * scaleY);
+                    keys[index] = (uint64_t(Hilbert(x, y)) << 32) | index;
+                }
+            });
+            std::sort(keys.begin(), keys.end());
+            order.resize(count);
+            For(count, [&](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; index++) {
+                    order[index] = uint32_t(keys[index]);
+                }
+            });
+        }
+
+        // Distance along the Hilbert curve of the cell (x, y) in a 2^16 grid
+        static uint32_t Hilbert(uint32_t x, uint32_t y) {
+            uint32_t distance = 0;
+            for (uint32_t side = 1u << 15; side > 0; side >>= 1) {
+                uint32_t rx = (x & side) > 0;
+                uint32_t ry = (y & side) > 0;
+                distance += side * side * ((3 * rx) ^ ry);
+                if (ry == 0) {
+                    if (rx == 1) {
+                        x = side - 1 - (x & (side - 1));
+                        y = side - 1 - (y & (side - 1));
+                    }
+                    std::swap(x, y);
+                }
+            }
+            return distance;
+        }
+
+        // Build the first triangle from the first three points in insertion
+        // order that are not collinear, moving them to the front of the order
+        bool Seed(size_t count) {
+            size_t second = 1;
+            while (second < count && Same(order[0], order[second])) {
+                second++;
+            }
+            size_t third = second + 1;
+            while (third < count && Orient(order[0], order[second], order[third]) == 0) {
+                third++;
+            }
+            if (third >= count) {
+                return false;
+            }
+            // Keep the remaining order intact apart from the seeds
+            uint32_t a = order[0], b = order[second], c = order[third];
+            std::rotate(order.begin() + second + 1, order.begin() + third, order.begin() + third + 1);
+            std::rotate(order.begin() + 1, order.begin() + second, order.begin() + second + 2);
+            if (Orient(a, b, c) < 0) {
+                std::swap(b, c);
+            }
+            visits.assign(4, 0);
+            mesh.push_back(Triangle{ { a, b, c }, { 1, 2, 3 } });
+            mesh.push_back(Triangle{ { c, b, Infinite }, { 3, 2, 0 } });
+            mesh.push_back(Triangle{ { a, c, Infinite }, { 1, 3, 0 } });
+            mesh.push_back(Triangle{ { b, a, Infinite }, { 2, 1, 0 } });
+            starts.assign(count + 1, 0);
+            last = 0;
+            epoch = 0;
+            return true;
+        }
+
+        void Insert(uint32_t point) {
+            uint32_t start = Locate(point);
+            const Triangle& found = mesh[start];
+            if (!IsGhost(found)) {
+                for (uint32_t vertex : found.vertices) {
+                    if (Same(vertex, point)) {
+                        return;
+                    }
+                }
+            }
+
+            // Collect the triangles in conflict and the edges bounding them
+            epoch++;
+            cavity.clear();
+            boundary.clear();
+            stack.clear();
+            stack.push_back(start);
+            visits[start] = epoch;
+            while (!stack.empty()) {
+                uint32_t current = stack.back();
+                stack.pop_back();
+                cavity.push_back(current);
+                for (int side = 0; side < 3; side++) {
+                    uint32_t neighbor = mesh[current].neighbors[side];
+                    if (visits[neighbor] == epoch) {
+                        continue;
+                    }
+                    if (Conflicts(neighbor, point)) {
+                        visits[neighbor] = epoch;
+                        stack.push_back(neighbor);
+                    }
+                    else {
+                        const Triangle& triangle = mesh[current];
+                        boundary.push_back(Edge{
+                            triangle.vertices[(side + 1) % 3], triangle.vertices[(side + 2) % 3], neighbor });
+                    }
+                }
+            }
+
+            // Join the point to every boundary edge, reusing the cavity slots
+            for (uint32_t slot : cavity) {
+                mesh[slot].vertices[0] = Unused;
+                unused.push_back(slot);
+            }
+            for (const Edge& edge : boundary) {
+                uint32_t slot = Allocate();
+                mesh[slot] = Triangle{ { edge.first, edge.second, point }, { Infinite, Infinite, edge.outside } };
+                Triangle& outside = mesh[edge.outside];
+                for (int side = 0; side < 3; side++) {
+                    uint32_t vertex = outside.vertices[side];
+                    if (vertex != edge.first && vertex != edge.second) {
+                        outside.neighbors[side] = slot;
+                    }
+                }
+                starts[Slot(edge.first)] = slot;
+                if (edge.first != Infinite && edge.second != Infinite) {
+                    last = slot;
+                }
+            }
+            // The triangles on either side of the edge from the point to b
+            // are the ones built on the boundary edges ending and starting at b
+            for (const Edge& edge : boundary) {
+                uint32_t self = starts[Slot(edge.first)];
+                uint32_t next = starts[Slot(edge.second)];
+                mesh[self].neighbors[0] = next;
+                mesh[next].neighbors[1] = self;
+            }
+        }
+
+        // Walk towards the point from the last inserted triangle. Returns a
+        // finite triangle containing it, or the ghost triangle beyond the
+        // hull edge it lies outside of.
+        uint32_t Locate(uint32_t point) {
+            uint32_t current = last;
+            if (IsGhost(mesh[current])) {
+                current = mesh[current].neighbors[GhostSide(mesh[current])];
+            }
+            while (true) {
+                const Triangle& triangle = mesh[current];
+                if (IsGhost(triangle)) {
+                    return current;
+                }
+                // Start from a varying edge so the walk cannot cycle
+                seed = seed * 1664525u + 1013904223u;
+                int offset = int(seed >> 30) % 3;
+                bool moved = false;
+                for (int step = 0; step < 3 && !moved; step++) {
+                    int side = (offset + step) % 3;
+                    uint32_t neighbor = triangle.neighbors[side];
+                    if (Orient(triangle.vertices[(side + 1) % 3], triangle.vertices[(side + 2) % 3], point) < 0) {
+                        current = neighbor;
+                        moved = true;
+                    }
+                }
+                if (!moved) {
+                    return current;
+                }
+            }
+        }
+
+        // Whether inserting the point removes the triangle
+        bool Conflicts(uint32_t index, uint32_t point) const {
+            const Triangle& triangle = mesh[index];
+            if (!IsGhost(triangle)) {
+                return Predicates::InCircle(
+                    points[triangle.vertices[0]], points[triangle.vertices[1]],
+                    points[triangle.vertices[2]], points[point]) > 0;
+            }
+            // A ghost conflicts with points strictly outside its hull edge, or inside the edge itself
+            int side = GhostSide(triangle);
+            uint32_t first = triangle.vertices[(side + 1) % 3];
+            uint32_t second = triangle.vertices[(side + 2) % 3];
+            int orientation = Orient(first, second, point);
+            if (orientation != 0) {
+                return orientation > 0;
+            }
+            const Vec2<T>& a = points[first];
+            const Vec2<T>& b = points[second];
+            const Vec2<T>& p = points[point];
+            if (a.GetX() != b.GetX()) {
+                return (a.GetX() < p.GetX() && p.GetX() < b.GetX()) || (b.GetX() < p.GetX() && p.GetX() < a.GetX());
+            }
+            return (a.GetY() < p.GetY() && p.GetY() < b.GetY()) || (b.GetY() < p.GetY() && p.GetY() < a.GetY());
+        }
+
+        uint32_t Allocate() {
+            if (!unused.empty()) {
+                uint32_t slot = unused.back();
+                unused.pop_back();
+                return slot;
+            }
+            mesh.push_back(Triangle{ { Unused, Unused, Unused }, { Infinite, Infinite, Infinite } });
+            visits.push_back(0);
+            return uint32_t(mesh.size() - 1);
+        }
+
+        // Write the finite triangles and walk the ghosts for the hull
+        void Output(size_t count) {
+            size_t ghost = mesh.size();
+            for (size_t index = 0; index < mesh.size(); index++) {
+                const Triangle& triangle = mesh[index];
+                if (triangle.vertices[0] == Unused) {
+                    continue;
+                }
+                if (IsGhost(triangle)) {
+                    ghost = index;
+                    continue;
+                }
+                triangles.insert(triangles.end(), triangle.vertices, triangle.vertices + 3);
+            }
+            // The ghost over hull edge a -> b holds (b, a, infinity) in
+            // rotation order, its neighbor opposite a is the next hull ghost
+            uint32_t current = uint32_t(ghost);
+            do {
+                const Triangle& triangle = mesh[current];
+                int side = (GhostSide(triangle) + 2) % 3;
+                hull.push_back(triangle.vertices[side]);
+                current = triangle.neighbors[side];
+            } while (current != ghost && hull.size() <= count);
+        }
+
+        bool IsGhost(const Triangle& triangle) const {
+            return triangle.vertices[0] == Infinite || triangle.vertices[1] == Infinite
+                || triangle.vertices[2] == Infinite;
+        }
+
+        // Position of the infinite vertex in a ghost triangle
+        static int GhostSide(const Triangle& triangle) {
+            return triangle.vertices[0] == Infinite ? 0 : triangle.vertices[1] == Infinite ? 1 : 2;
+        }
+
+        // Scratch slot of a vertex, the infinite vertex uses the last one
+        size_t Slot(uint32_t vertex) const {
+            return vertex == Infinite ? starts.size() - 1 : vertex;
+        }
+
+        int Orient(uint32_t a, uint32_t b, uint32_t c) const {
+            return Predicates::Orient2D(points[a], points[b], points[c]);
+        }
+
+        bool Same(uint32_t a, uint32_t b) const {
+            return points[a].GetX() == points[b].GetX() && points[a].GetY() == points[b].GetY();
+        }
+
+        ThreadPool* pool = nullptr;
+        const Vec2<T>* points = nullptr;
+        std::vector<uint32_t> triangles;
+        std::vector<uint32_t> hull;
+        std::vector<Triangle> mesh;
+        std::vector<uint32_t> unused;
+        std::vector<uint32_t> visits;
+        std::vector<uint32_t> starts;
+        std::vector<uint32_t> cavity;
+        std::vector<uint32_t> stack;
+        std::vector<Edge> boundary;
+        std::vector<uint64_t> keys;
+        std::vector<uint32_t> order;
+        uint32_t last = 0;
+        uint32_t epoch = 0;
+        uint32_t seed = 1;
+
+    };
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Math {
+
+    // Result of a batched intersection test. Bit i of mask is set when lane i
+    // hit, and distances[i] holds the hit distance along the ray for that lane
+    // (infinity for lanes that missed).
+    template<typename T, size_t N>
+    struct HitResult {
+
+        static_assert(N <= 32, "HitResult supports at most 32 lanes");
+
+        uint32_t mask = 0;
+
+        std::array<T, N> distances;
+
+        // Check whether lane index hit
+        constexpr bool Hit(size_t index) const { return (mask >> index) & 1u; }
+
+        // Check whether any lane hit
+        constexpr bool Any() const { return mask != 0; }
+
+        // Run test(lane, distance) for every lane, keeping hits only in lanes
+        // set in used. The tests run in one loop without a dependency between
+        // lanes and the mask is assembled afterwards, so the loop vectorizes.
+        template<typename Test>
+        static HitResult Collect(uint32_t used, const Test& test) {
+            HitResult result;
+            std::array<int32_t, N> hits;
+            for (size_t lane = 0; lane < N; lane++) {
+                T distance = T(0);
+                int32_t hit = test(lane, distance);
+                hits[lane] = hit;
+                result.distances[lane] = hit ? distance : std::numeric_limits<T>::infinity();
+            }
+            for (size_t lane = 0; lane < N; lane++) {
+                result.mask |= uint32_t(hits[lane]) << lane;
+            }
+            result.mask &= used;
+            for (size_t lane = 0; lane < N; lane++) {
+                if (!((used >> lane) & 1u)) {
+                    result.distances[lane] = std::numeric_limits<T>::infinity();
+                }
+            }
+            return result;
+        }
+
+    };
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+namespace Math {
+
+    // Branch-free per-lane intersection tests shared by the scalar and batched
+    // intersection methods. They take plain scalars so loops over SoA batches
+    // inline them and auto-vectorize.
+    namespace IntersectKernels {
+
+        // Plane of a slab that a ray crosses first, the min plane unless the
+        // ray points towards negative values on that axis
+        template<typename T>
+        constexpr T NearPlane(T inverse, T min, T max) { return inverse >= T(0) ? min : max; }
+
+        // Plane of a slab that a ray crosses last
+        template<typename T>
+        constexpr T FarPlane(T inverse, T min, T max) { return inverse >= T(0) ? max : min; }
+
+        // Narrow [entry, exit] to one slab of a box. A ray parallel to the slab
+        // gives +-inf distances, or 0 * inf = NaN when its origin lies on one
+        // of the planes. Comparisons with NaN are false, so a NaN leaves entry
+        // or exit unchanged and the origin counts as inside the closed slab.
+        template<typename T>
+        inline void ClipSlab(T origin, T inverse, T near, T far, T& entry, T& exit) {
+            T tNear = (near - origin) * inverse;
+            T tFar = (far - origin) * inverse;
+            entry = tNear > entry ? tNear : entry;
+            exit = tFar < exit ? tFar : exit;
+        }
+
+        // Slab test of a ray against an axis aligned box given by the planes
+        // the ray crosses first and last on each axis (see NearPlane and
+        // FarPlane). Writes the entry distance (0 when the origin is inside the
+        // box) and returns whether the ray hits the box in front of its origin.
+        // The box is closed, so rays along a face or an edge hit it.
+        template<typename T>
+        inline bool RayBox(
+            T ox, T oy, T oz,
+            T invDx, T invDy, T invDz,
+            T nearX, T nearY, T nearZ,
+            T farX, T farY, T farZ,
+            T& distance) {
+            T tNear = -std::numeric_limits<T>::infinity();
+            T tFar = std::numeric_limits<T>::infinity();
+            ClipSlab(ox, invDx, nearX, farX, tNear, tFar);
+            ClipSlab(oy, invDy, nearY, farY, tNear, tFar);
+            ClipSlab(oz, invDz, nearZ, farZ, tNear, tFar);
+            tNear = std::max(tNear, T(0));
+            distance = tNear;
+            return tNear <= tFar;
+        }
+
+        // Moller-Trumbore test of a ray against the triangle with vertex a and
+        // edges e1 = b - a and e2 = c - a. Writes the hit distance and returns
+        // whether the ray hits the triangle in front of its origin.
+        template<typename T>
+        inline bool RayTriangle(
+            T ox, T oy, T oz,
+            T dx, T dy, T dz,
+            T ax, T ay, T az,
+            T e1x, T e1y, T e1z,
+            T e2x, T e2y, T e2z,
+            T& distance) {
+            T px = dy * e2z - dz * e2y;
+            T py = dz * e2x - dx * e2z;
+            T pz = dx * e2y - dy * e2x;
+            T det = e1x * px + e1y * py + e1z * pz;
+            T invDet = T(1) / det;
+            T sx = ox - ax;
+            T sy = oy - ay;
+            T sz = oz - az;
+            T u = (sx * px + sy * py + sz * pz) * invDet;
+            T qx = sy * e1z - sz * e1y;
+            T qy = sz * e1x - sx * e1z;
+            T qz = sx * e1y - sy * e1x;
+            T v = (dx * qx + dy * qy + dz * qz) * invDet;
+            T t = (e2x * qx + e2y * qy + e2z * qz) * invDet;
+            distance = t;
+            return (det != T(0)) & (u >= T(0)) & (v >= T(0)) & (u + v <= T(1)) & (t > T(0));
+        }
+
+    }
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "../Vec3.h"
+
+#include <ostream>
+
+namespace Math {
+
+    // Plane of all points p where Dot(normal, p) == distance
+    template<typename T>
+    class Plane3 {
+
+    public:
+
+        // Empty constructor
+        Plane3() = delete;
+
+        // Default constructor, the normal is normalized
+        Plane3(const Vec3<T>& normal, T distance) :
+            normal(normal.Normalize()), distance(distance / normal.Magnitude()) {}
+
+        // Construct from a normal and any point on the plane
+        Plane3(const Vec3<T>& normal, const Vec3<T>& point) :
+            normal(normal.Normalize()),
+            distance(this->normal.Dot(point)) {}
+
+        // Copy constructor
+        Plane3(const Plane3<T>& other) = default;
+
+        // Move contstructor
+        Plane3(Plane3&& other) = default;
+
+        // Destructor
+        ~Plane3() = default;
+
+        // Copy assignment
+        Plane3& operator=(const Plane3& other) = default;
+
+        // Move assignment
+        Plane3& operator=(Plane3&& other) = default;
+
+        // Get the signed distance from the plane to a point, positive on the normal's side
+        constexpr T SignedDistanceTo(const Vec3<T>& point) const {
+            return normal.Dot(point) - distance;
+        }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(
+            std::ostream& stream, const Plane3<T>& plane) {
+            stream << "[" << plane.normal << ", " << plane.distance << "]";
+            return stream;
+        }
+
+        constexpr const Vec3<T>& GetNormal() const { return normal; }
+
+        constexpr T GetDistance() const { return distance; }
+
+    private:
+
+        Vec3<T> normal;
+        T distance;
+
+    };
+
+}
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "../Mat2.h"
+#include "../Mat3.h"
+#include "../Vec2.h"
+#include "../Vec3.h"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace Math {
+
+    // Adaptive exact geometric predicates after Shewchuk, "Adaptive Precision
+    // Floating-Point Arithmetic and Fast Robust Geometric Predicates". Each
+    // test first evaluates its Mat2 / Mat3 determinant in double and returns
+    // the sign when it is larger than a static bound on the rounding error.
+    // Only nearly degenerate inputs fall back to exact expansion arithmetic,
+    // so the result is always the sign of the exact determinant. Float inputs
+    // are evaluated in double. Requires IEEE round-to-nearest, so these must
+    // not be compiled with -ffast-math.
+    namespace Predicates {
+
+        namespace Detail {
+
+            constexpr double Epsilon = 1.1102230246251565e-16;
+            constexpr double Orient2DBound = (3.0 + 16.0 * Epsilon) * Epsilon;
+            constexpr double Orient3DBound = (7.0 + 56.0 * Epsilon) * Epsilon;
+            constexpr double InCircleBound = (10.0 + 96.0 * Epsilon) * Epsilon;
+
+            // a + b = sum + error exactly
+            inline void TwoSum(double a, double b, double& sum, double& error) {
+                sum = a + b;
+                double bVirtual = sum - a;
+                double aVirtual = sum - bVirtual;
+                error = (a - aVirtual) + (b - bVirtual);
+            }
+
+            // a * b = product + error exactly
+            inline void TwoProduct(double a, double b, double& product, double& error) {
+                product = a * b;
+                error = std::fma(a, b, -product);
+            }
+
+            // Sum of non-overlapping doubles in increasing magnitude, without
+            // zeros, so the last term carries the sign of the whole value
+            template<size_t N>
+            struct Expansion {
+
+                std::array<double, N> terms;
+                size_t size = 0;
+
+                // Add one double in place
+                void Grow(double value) {
+                    size_t count = 0;
+                    double sum = value;
+                    for (size_t index = 0; index < size; index++) {
+                        double error;
+                        TwoSum(sum, terms[index], sum, error);
+                        if (error != 0.0) {
+                            terms[count++] = error;
+                        }
+                    }
+                    if (sum != 0.0 || count == 0) {
+                        terms[count++] = sum;
+                    }
+                    size = count;
+                }
+
+                // Add another expansion in place
+                template<size_t M>
+                void Add(const Expansion<M>& other) {
+                    for (size_t index = 0; index < other.size; index++) {
+                        Grow(other.terms[index]);
+                    }
+                }
+
+                int Sign() const {
+                    double top = terms[size - 1];
+                    return (top > 0.0) - (top < 0.0);
+                }
+
+            };
+
+            // a - b exactly
+            inline Expansion<2> Difference(double a, double b) {
+                Expansion<2> result;
+                result.Grow(a);
+                result.Grow(-b);
+                return result;
+            }
+
+            // expansion * scalar exactly
+            template<size_t N>
+            Expansion<2 * N> Scale(const Expansion<N>& expansion, double scalar) {
+                Expansion<2 * N> result;
+                for (size_t index = 0; index < expansion.size; index++) {
+                    double product, error;
+                    TwoProduct(expansion.terms[index], scalar, product, error);
+                    result.Grow(error);
+                    result.Grow(product);
+                }
+                if (result.size == 0) {
+                    result.Grow(0.0);
+                }
+                return result;
+            }
+
+            // first * second exactly
+            template<size_t A, size_t B>
+            Expansion<2 * A * B> Multiply(const Expansion<A>& first, const Expansion<B>& second) {
+                Expansion<2 * A * B> result;
+                result.Grow(0.0);
+                for (size_t index = 0; index < second.size; index++) {
+                    result.Add(Scale(first, second.terms[index]));
+                }
+                return result;
+            }
+
+            template<size_t N>
+            Expansion<N> Negate(Expansion<N> expansion) {
+                for (size_t index = 0; index < expansion.size; index++) {
+                    expansion.terms[index] = -expansion.terms[index];
+                }
+                return expansion;
+            }
+
+            // first * second - third * fourth exactly
+            inline Expansion<16> Cross(
+                const Expansion<2>& first, const Expansion<2>& second,
+                const Expansion<2>& third, const Expansion<2>& fourth) {
+                Expansion<16> result;
+                result.Grow(0.0);
+                result.Add(Multiply(first, second));
+                result.Add(Negate(Multiply(third, fourth)));
+                return result;
+            }
+
+            inline int Sign(double value) {
+                return (value > 0.0) - (value < 0.0);
+            }
+
+            inline int Orient2DExact(double ax, double ay, double bx, double by, double cx, double cy) {
+                return Cross(Difference(ax, cx), Difference(by, cy), Difference(ay, cy), Difference(bx, cx)).Sign();
+            }
+
+            inline int Orient3DExact(
+                double ax, double ay, double az, double bx, double by, double bz,
+                double cx, double cy, double cz, double dx, double dy, double dz) {
+                Expansion<2> adx = Difference(ax, dx), ady = Difference(ay, dy), adz = Difference(az, dz);
+                Expansion<2> bdx = Difference(bx, dx), bdy = Difference(by, dy), bdz = Difference(bz, dz);
+                Expansion<2> cdx = Difference(cx, dx), cdy = Difference(cy, dy), cdz = Difference(cz, dz);
+                Expansion<192> result;
+                result.Grow(0.0);
+                result.Add(Multiply(Cross(bdx, cdy, bdy, cdx), adz));
+                result.Add(Multiply(Cross(cdx, ady, cdy, adx), bdz));
+                result.Add(Multiply(Cross(adx, bdy, ady, bdx), cdz));
+                return result.Sign();
+            }
+
+            inline int InCircleExact(
+                double ax, double ay, double bx, double by,
+                double cx, double cy, double dx, double dy) {
+                Expansion<2> adx = Difference(ax, dx), ady = Difference(ay, dy);
+                Expansion<2> bdx = Difference(bx, dx), bdy = Difference(by, dy);
+                Expansion<2> cdx = Difference(cx, dx), cdy = Difference(cy, dy);
+                auto lift = [](const Expansion<2>& x, const Expansion<2>& y) {
+                    Expansion<16> result;
+                    result.Grow(0.0);
+                    result.Add(Multiply(x, x));
+                    result.Add(Multiply(y, y));
+                    return result;
+                };
+                Expansion<1536> result;
+                result.Grow(0.0);
+                result.Add(Multiply(lift(adx, ady), Cross(bdx, cdy, cdx, bdy)));
+                result.Add(Multiply(lift(bdx, bdy), Cross(cdx, ady, adx, cdy)));
+                result.Add(Multiply(lift(cdx, cdy), Cross(adx, bdy, bdx, ady)));
+                return result.Sign();
+            }
+
+        }
+
+        // 1 when a, b, c turn counter-clockwise, -1 when clockwise, 0 when collinear
+        template<typename T>
+        int Orient2D(const Vec2<T>& a, const Vec2<T>& b, const Vec2<T>& c) {
+            static_assert(std::is_floating_point_v<T> && sizeof(T) <= sizeof(double),
+                "Predicates need float or double coordinates");
+            double ax = a.GetX(), ay = a.GetY(), bx = b.GetX(), by = b.GetY(), cx = c.GetX(), cy = c.GetY();
+            double left = (ax - cx) * (by - cy);
+            double right = (ay - cy) * (bx - cx);
+            double det = Mat2<double>(ax - cx, ay - cy, bx - cx, by - cy).Determinant();
+            double bound = Detail::Orient2DBound * (std::fabs(left) + std::fabs(right));
+            if (det > bound || -det > bound) {
+                return Detail::Sign(det);
+            }
+            return Detail::Orient2DExact(ax, ay, bx, by, cx, cy);
+        }
+
+        // 1 when d lies below the plane through a, b, c, where a, b, c appear
+        // counter-clockwise seen from above, -1 when above, 0 when coplanar
+        template<typename T>
+        int Orient3D(const Vec3<T>& a, const Vec3<T>& b, const Vec3<T>& c, const Vec3<T>& d) {
+            static_assert(std::is_floating_point_v<T> && sizeof(T) <= sizeof(double),
+                "Predicates need float or double coordinates");
+            double dx = d.GetX(), dy = d.GetY(), dz = d.GetZ();
+            double adx = a.GetX() - dx, ady = a.GetY() - dy, adz = a.GetZ() - dz;
+            double bdx = b.GetX() - dx, bdy = b.GetY() - dy, bdz = b.GetZ() - dz;
+            double cdx = c.GetX() - dx, cdy = c.GetY() - dy, cdz = c.GetZ() - dz;
+            double det = Mat3<double>(adx, ady, adz, bdx, bdy, bdz, cdx, cdy, cdz).Determinant();
+            double permanent =
+                (std::fabs(bdx * cdy) + std::fabs(bdy * cdx)) * std::fabs(adz)
+                + (std::fabs(cdx * ady) + std::fabs(cdy * adx)) * std::fabs(bdz)
+                + (std::fabs(adx * bdy) + std::fabs(ady * bdx)) * std::fabs(cdz);
+            double bound = Detail::Orient3DBound * permanent;
+            if (det > bound || -det > bound) {
+                return Detail::Sign(det);
+            }
+            return Detail::Orient3DExact(
+                a.GetX(), a.GetY(), a.GetZ(), b.GetX(), b.GetY(), b.GetZ(),
+                c.GetX(), c.GetY(), c.GetZ(), dx, dy, dz);
+        }
+
+        // 1 when d lies inside the circle through a, b, c, given counter-clockwise,
+        // -1 when outside, 0 when on it. The sign flips for clockwise a, b, c.
+        template<typename T>
+        int InCircle(const Vec2<T>& a, const Vec2<T>& b, const Vec2<T>& c, const Vec2<T>& d) {
+            static_assert(std::is_floating_point_v<T> && sizeof(T) <= sizeof(double),
+                "Predicates need float or double coordinates");
+            double dx = d.GetX(), dy = d.GetY();
+            double adx = a.GetX() - dx, ady = a.GetY() - dy;
+            double bdx = b.GetX() - dx, bdy = b.GetY() - dy;
+            double cdx = c.GetX() - dx, cdy = c.GetY() - dy;
+            double aLift = adx * adx + ady * ady;
+            double bLift = bdx * bdx + bdy * bdy;
+            double cLift = cdx * cdx + cdy * cdy;
+            double det = Mat3<double>(adx, ady, aLift, bdx, bdy, bLift, cdx, cdy, cLift).Determinant();
+            double permanent =
+                (std::fabs(bdx * cdy) + std::fabs(cdx * bdy)) * aLift
+                + (std::fabs(cdx * ady) + std::fabs(adx * cdy)) * bLift
+                + (std::fabs(adx * bdy) + std::fabs(bdx * ady)) * cLift;
+            double bound = Detail::InCircleBound * permanent;
+            if (det > bound || -det > bound) {
+                return Detail::Sign(det);
+            }
+            return Detail::InCircleExact(
+                a.GetX(), a.GetY(), b.GetX(), b.GetY(), c.GetX(), c.GetY(), dx, dy);
+        }
+
+    }
+
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "AABB3.h"
+#include "IntersectKernels.h"
+#include "Plane3.h"
+#include "Triangle3.h"
+#include "../Vec3.h"
+
+#include <ostream>
+
+namespace Math {
+
+    template<typename T>
+    class Ray3 {
+
+    public:
+
+        // Empty constructor
+        Ray3() = delete;
+
+        // Default constructor, the direction is normalized so hit distances are euclidean
+        Ray3(const Vec3<T>& origin, const Vec3<T>& direction) :
+            origin(origin),
+            direction(direction.Normalize()),
+            inverseDirection(
+                T(1) / this->direction.GetX(),
+                T(1) / this->direction.GetY(),
+                T(1) / this->direction.GetZ()) {}
+
+        // Copy constructor
+        Ray3(const Ray3<T>& other) = default;
+
+        // Move contstructor
+        Ray3(Ray3&& other) = default;
+
+        // Destructor
+        ~Ray3() = default;
+
+        // Copy assignment
+        Ray3& operator=(const Ray3& other) = default;
+
+        // Move assignment
+        Ray3& operator=(Ray3&& other) = default;
+
+        // Get the point at a distance along this ray
+        constexpr Vec3<T> PointAt(T distance) const {
+            return origin.Add(direction.Scale(distance));
+        }
+
+        // Intersect with a box, distance is 0 when the origin is inside the box
+        bool Intersect(const AABB3<T>& box, T& distance) const {
+            T ix = inverseDirection.GetX(), iy = inverseDirection.GetY(), iz = inverseDirection.GetZ();
+            const auto& min = box.GetMin();
+            const auto& max = box.GetMax();
+            return IntersectKernels::RayBox(
+                origin.GetX(), origin.GetY(), origin.GetZ(), ix, iy, iz,
+                IntersectKernels::NearPlane(ix, min.GetX(), max.GetX()),
+                IntersectKernels::NearPlane(iy, min.GetY(), max.GetY()),
+                IntersectKernels::NearPlane(iz, min.GetZ(), max.GetZ()),
+                IntersectKernels::FarPlane(ix, min.GetX(), max.GetX()),
+                IntersectKernels::FarPlane(iy, min.GetY(), max.GetY()),
+                IntersectKernels::FarPlane(iz, min.GetZ(), max.GetZ()),
+                distance);
+        }
+
+        // Intersect with a triangle from either side
+        bool Intersect(const Triangle3<T>& triangle, T& distance) const {
+            const auto& a = triangle.GetA();
+            const auto& b = triangle.GetB();
+            const auto& c = triangle.GetC();
+            return IntersectKernels::RayTriangle(
+                origin.GetX(), origin.GetY(), origin.GetZ(),
+                direction.GetX(), direction.GetY(), direction.GetZ(),
+                a.GetX(), a.GetY(), a.GetZ(),
+                b.GetX() - a.GetX(), b.GetY() - a.GetY(), b.GetZ() - a.GetZ(),
+                c.GetX() - a.GetX(), c.GetY() - a.GetY(), c.GetZ() - a.GetZ(),
+                distance);
+        }
+
+        // Intersect with a plane from either side
+        bool Intersect(const Plane3<T>& plane, T& distance) const {
+            T denominator = plane.GetNormal().Dot(direction);
+            if (denominator == T(0)) {
+                return false;
+            }
+            distance = -plane.SignedDistanceTo(origin) / denominator;
+            return distance >= T(0);
+        }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(
+            std::ostream& stream, const Ray3<T>& ray) {
+            stream << "[" << ray.origin << ", " << ray.direction << "]";
+            return stream;
+        }
+
+        constexpr const Vec3<T>& GetOrigin() const { return origin; }
+
+        constexpr const Vec3<T>& GetDirection() const { return direction; }
+
+        constexpr const Vec3<T>& GetInverseDirection() const { return inverseDirection; }
+
+    private:
+
+        Vec3<T> origin, direction, inverseDirection;
+
+    };
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "AABB3.h"
+#include "HitResult.h"
+#include "IntersectKernels.h"
+#include "Ray3.h"
+#include "Triangle3.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Math {
+
+    // N rays stored component-wise (SoA) so a packet of coherent rays can be
+    // tested against one primitive in a single vectorized pass. Typical sizes
+    // are 4, 8 and 16.
+    template<typename T, size_t N>
+    class Ray3Packet {
+
+    public:
+
+        static_assert(N <= 32, "Ray3Packet supports at most 32 lanes");
+
+        // Empty constructor, every lane starts unused
+        Ray3Packet() = default;
+
+        // Store a ray in lane index
+        void Set(size_t index, const Ray3<T>& ray) {
+            originX[index] = ray.GetOrigin().GetX();
+            originY[index] = ray.GetOrigin().GetY();
+            originZ[index] = ray.GetOrigin().GetZ();
+            directionX[index] = ray.GetDirection().GetX();
+            directionY[index] = ray.GetDirection().GetY();
+            directionZ[index] = ray.GetDirection().GetZ();
+            inverseX[index] = ray.GetInverseDirection().GetX();
+            inverseY[index] = ray.GetInverseDirection().GetY();
+            inverseZ[index] = ray.GetInverseDirection().GetZ();
+            used |= uint32_t(1) << index;
+        }
+
+        // Intersect every ray with one box, unused lanes never hit
+        HitResult<T, N> Intersect(const AABB3<T>& box) const {
+            T minX = box.GetMin().GetX(), minY = box.GetMin().GetY(), minZ = box.GetMin().GetZ();
+            T maxX = box.GetMax().GetX(), maxY = box.GetMax().GetY(), maxZ = box.GetMax().GetZ();
+            return HitResult<T, N>::Collect(used, [&](size_t lane, T& distance) {
+                T ix = inverseX[lane], iy = inverseY[lane], iz = inverseZ[lane];
+                return IntersectKernels::RayBox(
+                    originX[lane], originY[lane], originZ[lane], ix, iy, iz,
+                    IntersectKernels::NearPlane(ix, minX, maxX),
+                    IntersectKernels::NearPlane(iy, minY, maxY),
+                    IntersectKernels::NearPlane(iz, minZ, maxZ),
+                    IntersectKernels::FarPlane(ix, minX, maxX),
+                    IntersectKernels::FarPlane(iy, minY, maxY),
+                    IntersectKernels::FarPlane(iz, minZ, maxZ),
+                    distance);
+            });
+        }
+
+        // Intersect every ray with one triangle, unused lanes never hit
+        HitResult<T, N> Intersect(const Triangle3<T>& triangle) const {
+            const auto& a = triangle.GetA();
+            const auto& b = triangle.GetB();
+            const auto& c = triangle.GetC();
+            T e1x = b.GetX() - a.GetX(), e1y = b.GetY() - a.GetY(), e1z = b.GetZ() - a.GetZ();
+            T e2x = c.GetX() - a.GetX(), e2y = c.GetY() - a.GetY(), e2z = c.GetZ() - a.GetZ();
+            return HitResult<T, N>::Collect(used, [&](size_t lane, T& distance) {
+                return IntersectKernels::RayTriangle(
+                    originX[lane], originY[lane], originZ[lane],
+                    directionX[lane], directionY[lane], directionZ[lane],
+                    a.GetX(), a.GetY(), a.GetZ(),
+                    e1x, e1y, e1z, e2x, e2y, e2z,
+                    distance);
+            });
+        }
+
+    private:
+
+        std::array<T, N> originX{}, originY{}, originZ{};
+        std::array<T, N> directionX{}, directionY{}, directionZ{};
+        std::array<T, N> inverseX{}, inverseY{}, inverseZ{};
+        uint32_t used = 0;
+
+    };
+
+}
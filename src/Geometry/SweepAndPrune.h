@@ -0,0 +1,324 @@
+#pragma once
+
+#include "AABB3.h"
+#include "../Async/Async.h"
+#include "../Async/ThreadPool.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Math {
+
+    // Sort-and-sweep broadphase over a set of moving boxes. Boxes are kept
+    // component-wise (SoA). Each frame the box minima along the axis with the
+    // largest spread are sorted, reusing last frame's order with an insertion
+    // sort when objects moved little and falling back to a radix sort
+    // otherwise, then a sweep writes every overlapping pair into one compact
+    // buffer. Given a ThreadPool the radix sort and the sweep run in parallel;
+    // the output order does not depend on the number of threads.
+    template<typename T>
+    class SweepAndPrune {
+
+    public:
+
+        static_assert(std::is_floating_point_v<T>, "SweepAndPrune needs floating point boxes");
+
+        struct Pair {
+            uint32_t first, second;
+        };
+
+        // Empty constructor, runs on the calling thread
+        SweepAndPrune() = default;
+
+        // Pool constructor, sorting and sweeping are split across the pool
+        explicit SweepAndPrune(ThreadPool& pool) : pool(&pool) {}
+
+        // Copy constructor
+        SweepAndPrune(const SweepAndPrune<T>& other) = default;
+
+        // Move contstructor
+        SweepAndPrune(SweepAndPrune&& other) = default;
+
+        // Destructor
+        ~SweepAndPrune() = default;
+
+        // Copy assignment
+        SweepAndPrune& operator=(const SweepAndPrune& other) = default;
+
+        // Move assignment
+        SweepAndPrune& operator=(SweepAndPrune&& other) = default;
+
+        // Replace every box. Changing the count discards last frame's order.
+        void Update(const AABB3<T>* boxes, size_t count) {
+            if (count != Size()) {
+                for (size_t axis = 0; axis < 3; axis++) {
+                    min[axis].resize(count);
+                    max[axis].resize(count);
+                }
+                order.clear();
+            }
+            For(count, [this, boxes](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; index++) {
+                    Store(index, boxes[index]);
+                }
+            });
+        }
+
+        // Replace one box
+        void Update(size_t index, const AABB3<T>& box) {
+            Store(index, box);
+        }
+
+        // Get the number of boxes
+        size_t Size() const { return min[0].size(); }
+
+        // Find every pair of overlapping boxes, each reported once with the
+        // smaller index first. The buffer is reused between calls.
+        const std::vector<Pair>& FindPairs() {
+            pairs.clear();
+            size_t count = Size();
+            if (count < 2) {
+                return pairs;
+            }
+            size_t axis = SelectAxis();
+            if (axis != sortAxis || order.size() != count || !InsertionSort(axis)) {
+                RadixSort(axis);
+            }
+            sortAxis = axis;
+            Sweep(axis);
+            return pairs;
+        }
+
+    private:
+
+        using Key = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+        // Number of items each parallel task handles
+        static constexpr size_t Grain = 16384;
+
+        // Swaps allowed per object before the insertion sort gives up
+        static constexpr size_t SwapBudget = 8;
+
+        void Store(size_t index, const AABB3<T>& box) {
+            min[0][index] = box.GetMin().GetX();
+            min[1][index] = box.GetMin().GetY();
+            min[2][index] = box.GetMin().GetZ();
+            max[0][index] = box.GetMax().GetX();
+            max[1][index] = box.GetMax().GetY();
+            max[2][index] = box.GetMax().GetZ();
+        }
+
+        // Run body(begin, end) over [0, count), on the pool when there is one
+        template<typename Body>
+        void For(size_t count, const Body& body) const {
+            if (pool == nullptr || count <= Grain) {
+                body(0, count);
+                return;
+            }
+            Async::Options options;
+            options.pool = pool;
+            options.grain = Grain;
+            auto done = Async::ParallelFor(count, body, options);
+            pool->Wait(done);
+        }
+
+        // Pick the axis along which box centers spread the most. The sums
+        // run in double, float sums of a million squares lose the variance.
+        size_t SelectAxis() const {
+            size_t count = Size();
+            size_t best = 0;
+            double bestVariance = -1.0;
+            for (size_t axis = 0; axis < 3; axis++) {
+                double sum = 0.0, sumSqr = 0.0;
+                for (size_t index = 0; index < count; index++) {
+                    double center = double(min[axis][index]) + double(max[axis][index]);
+                    sum += center;
+                    sumSqr += center * center;
+                }
+                double variance = sumSqr - sum * sum / double(count);
+                if (variance > bestVariance) {
+                    bestVariance = variance;
+                    best = axis;
+                }
+            }
+            return best;
+        }
+
+        // Map a float to an unsigned key with the same ordering
+        static Key ToKey(T value) {
+            Key bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            constexpr Key sign = Key(1) << (sizeof(Key) * 8 - 1);
+            return (bits & sign) ? ~bits : (bits | sign);
+        }
+
+        // Re-sort last frame's order, exploiting that objects moved little.
+        // Returns false when the work exceeds the swap budget.
+        bool InsertionSort(size_t axis) {
+            const T* keys = min[axis].data();
+            size_t count = order.size();
+            size_t budget = count * SwapBudget;
+            for (size_t index = 1; index < count; index++) {
+                uint32_t current = order[index];
+                T key = keys[current];
+                size_t position = index;
+                while (position > 0 && keys[order[position - 1]] > key) {
+                    order[position] = order[position - 1];
+                    position--;
+                    if (budget-- == 0) {
+                        order[position] = current;
+                        return false;
+                    }
+                }
+                order[position] = current;
+            }
+            return true;
+        }
+
+        // Stable least significant digit radix sort of the minima, 8 bits per pass
+        void RadixSort(size_t axis) {
+            size_t count = Size();
+            size_t chunks = pool == nullptr ? 1 : (count + Grain - 1) / Grain;
+            keys.resize(count);
+            keysScratch.resize(count);
+            order.resize(count);
+            orderScratch.resize(count);
+            histograms.assign(chunks, {});
+
+            const T* values = min[axis].data();
+            For(count, [this, values](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; index++) {
+                    keys[index] = ToKey(values[index]);
+                    order[index] = uint32_t(index);
+                }
+            });
+
+            for (size_t shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+                ForChunks(count, chunks, [this, shift](size_t chunk, size_t begin, size_t end) {
+                    auto& histogram = histograms[chunk];
+                    histogram.fill(0);
+                    for (size_t index = begin; index < end; index++) {
+                        histogram[(keys[index] >> shift) & 0xFF]++;
+                    }
+                });
+
+                // Offsets are digit-major then chunk-minor, which keeps the sort stable
+                size_t offset = 0;
+                bool trivial = false;
+                for (size_t digit = 0; digit < 256; digit++) {
+                    size_t digitTotal = 0;
+                    for (size_t chunk = 0; chunk < chunks; chunk++) {
+                        size_t bucket = histograms[chunk][digit];
+                        histograms[chunk][digit] = offset;
+                        offset += bucket;
+                        digitTotal += bucket;
+                    }
+                    trivial |= digitTotal == count;
+                }
+                if (trivial) {
+                    // Every key has the same digit, this pass would not move anything
+                    continue;
+                }
+
+                ForChunks(count, chunks, [this, shift](size_t chunk, size_t begin, size_t end) {
+                    auto& histogram = histograms[chunk];
+                    for (size_t index = begin; index < end; index++) {
+                        size_t target = histogram[(keys[index] >> shift) & 0xFF]++;
+                        keysScratch[target] = keys[index];
+                        orderScratch[target] = order[index];
+                    }
+                });
+                keys.swap(keysScratch);
+                order.swap(orderScratch);
+            }
+        }
+
+        // Run body(chunk, begin, end) for each of chunks equal slices of [0, count)
+        template<typename Body>
+        void ForChunks(size_t count, size_t chunks, const Body& body) const {
+            auto slice = [&body, count, chunks](size_t begin, size_t end) {
+                for (size_t chunk = begin; chunk < end; chunk++) {
+                    body(chunk, chunk * count / chunks, (chunk + 1) * count / chunks);
+                }
+            };
+            if (pool == nullptr || chunks == 1) {
+                slice(0, chunks);
+                return;
+            }
+            Async::Options options;
+            options.pool = pool;
+            options.grain = 1;
+            auto done = Async::ParallelFor(chunks, slice, options);
+            pool->Wait(done);
+        }
+
+        // Walk the sorted boxes, testing each against the following boxes
+        // whose minimum starts before its maximum along the sort axis
+        void Sweep(size_t axis) {
+            size_t count = Size();
+            size_t other1 = (axis + 1) % 3;
+            size_t other2 = (axis + 2) % 3;
+
+            // Gather the bounds into sorted order so the sweep reads memory linearly
+            for (size_t bound = 0; bound < 6; bound++) {
+                sorted[bound].resize(count);
+            }
+            For(count, [&](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; index++) {
+                    uint32_t object = order[index];
+                    sorted[0][index] = min[axis][object];
+                    sorted[1][index] = max[axis][object];
+                    sorted[2][index] = min[other1][object];
+                    sorted[3][index] = max[other1][object];
+                    sorted[4][index] = min[other2][object];
+                    sorted[5][index] = max[other2][object];
+                }
+            });
+
+            size_t chunks = pool == nullptr ? 1 : (count + Grain - 1) / Grain;
+            chunkPairs.resize(chunks);
+            ForChunks(count, chunks, [this, count](size_t chunk, size_t begin, size_t end) {
+                auto& local = chunkPairs[chunk];
+                local.clear();
+                for (size_t index = begin; index < end; index++) {
+                    T maxA = sorted[1][index];
+                    T minB = sorted[2][index], maxB = sorted[3][index];
+                    T minC = sorted[4][index], maxC = sorted[5][index];
+                    for (size_t next = index + 1; next < count && sorted[0][next] <= maxA; next++) {
+                        // Evaluate all four tests so the only branch is the
+                        // rarely taken one, && would mispredict on each
+                        bool overlap = (sorted[2][next] <= maxB) & (sorted[3][next] >= minB)
+                            & (sorted[4][next] <= maxC) & (sorted[5][next] >= minC);
+                        if (overlap) {
+                            uint32_t first = order[index];
+                            uint32_t second = order[next];
+                            local.push_back(first < second ? Pair{ first, second } : Pair{ second, first });
+                        }
+                    }
+                }
+            });
+            for (const auto& local : chunkPairs) {
+                pairs.insert(pairs.end(), local.begin(), local.end());
+            }
+        }
+
+        ThreadPool* pool = nullptr;
+
+        std::array<std::vector<T>, 3> min, max;
+
+        size_t sortAxis = 3;
+        std::vector<uint32_t> order, orderScratch;
+        std::vector<Key> keys, keysScratch;
+        std::vector<std::array<size_t, 256>> histograms;
+        std::array<std::vector<T>, 6> sorted;
+
+        std::vector<std::vector<Pair>> chunkPairs;
+        std::vector<Pair> pairs;
+
+    };
+
+}
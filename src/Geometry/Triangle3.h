@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../Vec3.h"
+
+#include <ostream>
+
+namespace Math {
+
+    template<typename T>
+    class Triangle3 {
+
+    public:
+
+        // Empty constructor
+        Triangle3() = delete;
+
+        // Default constructor, vertices in counter-clockwise order face the normal
+        constexpr Triangle3(const Vec3<T>& a, const Vec3<T>& b, const Vec3<T>& c) :
+            a(a), b(b), c(c) {}
+
+        // Copy constructor
+        constexpr Triangle3(const Triangle3<T>& other) = default;
+
+        // Move contstructor
+        constexpr Triangle3(Triangle3&& other) = default;
+
+        // Destructor
+        ~Triangle3() = default;
+
+        // Copy assignment
+        constexpr Triangle3& operator=(const Triangle3& other) = default;
+
+        // Move assignment
+        constexpr Triangle3& operator=(Triangle3&& other) = default;
+
+        // Get the unit normal of this triangle
+        Vec3<T> Normal() const {
+            Vec3<T> e1(b.GetX() - a.GetX(), b.GetY() - a.GetY(), b.GetZ() - a.GetZ());
+            Vec3<T> e2(c.GetX() - a.GetX(), c.GetY() - a.GetY(), c.GetZ() - a.GetZ());
+            return e1.Cross(e2).Normalize();
+        }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(
+            std::ostream& stream, const Triangle3<T>& triangle) {
+            stream << "[" << triangle.a << ", " << triangle.b << ", " << triangle.c << "]";
+            return stream;
+        }
+
+        constexpr const Vec3<T>& GetA() const { return a; }
+
+        constexpr const Vec3<T>& GetB() const { return b; }
+
+        constexpr const Vec3<T>& GetC() const { return c; }
+
+    private:
+
+        Vec3<T> a, b, c;
+
+    };
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "HitResult.h"
+#include "IntersectKernels.h"
+#include "Ray3.h"
+#include "Triangle3.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Math {
+
+    // N triangles stored component-wise (SoA) as a vertex and two edges so one
+    // ray can be tested against all of them in a single vectorized pass.
+    // Typical sizes are 4, 8 and 16.
+    template<typename T, size_t N>
+    class Triangle3Batch {
+
+    public:
+
+        static_assert(N <= 32, "Triangle3Batch supports at most 32 lanes");
+
+        // Empty constructor, every lane starts unused
+        Triangle3Batch() = default;
+
+        // Store a triangle in lane index
+        void Set(size_t index, const Triangle3<T>& triangle) {
+            const auto& a = triangle.GetA();
+            const auto& b = triangle.GetB();
+            const auto& c = triangle.GetC();
+            aX[index] = a.GetX();
+            aY[index] = a.GetY();
+            aZ[index] = a.GetZ();
+            e1X[index] = b.GetX() - a.GetX();
+            e1Y[index] = b.GetY() - a.GetY();
+            e1Z[index] = b.GetZ() - a.GetZ();
+            e2X[index] = c.GetX() - a.GetX();
+            e2Y[index] = c.GetY() - a.GetY();
+            e2Z[index] = c.GetZ() - a.GetZ();
+            used |= uint32_t(1) << index;
+        }
+
+        // Intersect one ray with every triangle, unused lanes never hit
+        HitResult<T, N> Intersect(const Ray3<T>& ray) const {
+            const auto& origin = ray.GetOrigin();
+            const auto& direction = ray.GetDirection();
+            T ox = origin.GetX(), oy = origin.GetY(), oz = origin.GetZ();
+            T dx = direction.GetX(), dy = direction.GetY(), dz = direction.GetZ();
+            return HitResult<T, N>::Collect(used, [&](size_t lane, T& distance) {
+                return IntersectKernels::RayTriangle(
+                    ox, oy, oz, dx, dy, dz,
+                    aX[lane], aY[lane], aZ[lane],
+                    e1X[lane], e1Y[lane], e1Z[lane],
+                    e2X[lane], e2Y[lane], e2Z[lane],
+                    distance);
+            });
+        }
+
+    private:
+
+        std::array<T, N> aX{}, aY{}, aZ{};
+        std::array<T, N> e1X{}, e1Y{}, e1Z{};
+        std::array<T, N> e2X{}, e2Y{}, e2Z{};
+        uint32_t used = 0;
+
+    };
+
+}
@@ -0,0 +1,254 @@
+#pragma once
+
+#include "Config.h"
+#include "Exception/MatrixException.h"
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace Math {
+
+    template<typename T, size_t Rows, size_t Cols>
+    class Mat {
+
+    public:
+
+        static const Mat<T, Rows, Cols> Identity;
+
+        // Empty constructor
+        Mat() = delete;
+
+        // Constructor, values are given in row-major order
+        template<typename... Values, typename = std::enable_if_t<
+            sizeof...(Values) == Rows * Cols && (std::is_convertible_v<Values, T> && ...)>>
+        constexpr Mat(Values... values) : values{ { T(values)... } } {}
+
+        // Copy constructor
+        constexpr Mat(const Mat<T, Rows, Cols>& other) = default;
+
+        // Move contstructor
+        constexpr Mat(Mat&& other) = default;
+
+        // Destructor
+        ~Mat() = default;
+
+        // Copy assignment
+        constexpr Mat& operator=(const Mat& other) = default;
+
+        // Move assignment
+        constexpr Mat& operator=(Mat&& other) = default;
+
+        // Const Multiply by other Cols x N Matrix
+        template<size_t N>
+        constexpr Mat<T, Rows, N> Multiply(const Mat<T, Cols, N>& other) const {
+            return MultiplyImpl(other, std::make_index_sequence<Rows * N>());
+        }
+
+        // Const Transpose
+        constexpr Mat<T, Cols, Rows> Transpose() const {
+            return TransposeImpl(std::make_index_sequence<Rows * Cols>());
+        }
+
+        // Const Scale
+        constexpr Mat<T, Rows, Cols> Scale(T scalar) const {
+            return ScaleImpl(scalar, std::make_index_sequence<Rows * Cols>());
+        }
+
+
+        // Mutator Multiply by other square Matrix
+        constexpr Mat<T, Rows, Cols> Multiply(const Mat<T, Cols, Cols>& other) {
+            *this = MultiplyImpl(other, std::make_index_sequence<Rows * Cols>());
+            return *this;
+        }
+
+        // Mutator Transpose, only defined for square matrices
+        template<size_t R = Rows, typename = std::enable_if_t<R == Cols>>
+        constexpr Mat<T, Rows, Cols> Transpose() {
+            *this = TransposeImpl(std::make_index_sequence<Rows * Cols>());
+            return *this;
+        }
+
+        // Mutator Scale
+        constexpr Mat<T, Rows, Cols> Scale(T scalar) {
+            *this = ScaleImpl(scalar, std::make_index_sequence<Rows * Cols>());
+            return *this;
+        }
+
+
+        // Get the determinant of this matrix
+        constexpr T Determinant() const {
+            static_assert(Rows == Cols, "Determinant is only defined for square matrices");
+            if constexpr (Rows == 1) {
+                return values[0];
+            }
+            else if constexpr (Rows == 2) {
+                return values[0] * values[3] - values[1] * values[2];
+            }
+            else if constexpr (Rows == 3) {
+                return values[0] * (values[4] * values[8] - values[5] * values[7])
+                    - values[1] * (values[3] * values[8] - values[5] * values[6])
+                    + values[2] * (values[3] * values[7] - values[4] * values[6]);
+            }
+            else {
+                // Gaussian elimination with partial pivoting
+                std::array<T, Rows * Cols> m = values;
+                T det = T(1);
+                for (size_t col = 0; col < Cols; col++) {
+                    size_t pivot = FindPivot(m, col);
+                    if (m[pivot * Cols + col] == T(0)) {
+                        return T(0);
+                    }
+                    if (pivot != col) {
+                        SwapRows(m, pivot, col);
+                        det = -det;
+                    }
+                    T diagonal = m[col * Cols + col];
+                    det *= diagonal;
+                    for (size_t row = col + 1; row < Rows; row++) {
+                        T factor = m[row * Cols + col] / diagonal;
+                        for (size_t k = col; k < Cols; k++) {
+                            m[row * Cols + k] -= factor * m[col * Cols + k];
+                        }
+                    }
+                }
+                return det;
+            }
+        }
+
+        // Get the inverse of this matrix
+        constexpr Mat<T, Rows, Cols> Inverse() const {
+            static_assert(Rows == Cols, "Inverse is only defined for square matrices");
+            if constexpr (Rows == 2) {
+                auto det = Determinant();
+                if (det == 0) {
+                    throw MatrixException(MatrixError::NOT_INVERTIBLE);
+                }
+                return Mat<T, Rows, Cols>(
+                    values[3] / det, -values[1] / det,
+                    -values[2] / det, values[0] / det);
+            }
+            else {
+                // Gauss-Jordan elimination with partial pivoting
+                std::array<T, Rows * Cols> m = values;
+                std::array<T, Rows * Cols> inv = Identity.values;
+                for (size_t col = 0; col < Cols; col++) {
+                    size_t pivot = FindPivot(m, col);
+                    if (m[pivot * Cols + col] == T(0)) {
+                        throw MatrixException(MatrixError::NOT_INVERTIBLE);
+                    }
+                    if (pivot != col) {
+                        SwapRows(m, pivot, col);
+                        SwapRows(inv, pivot, col);
+                    }
+                    T diagonal = m[col * Cols + col];
+                    for (size_t k = 0; k < Cols; k++) {
+                        m[col * Cols + k] /= diagonal;
+                        inv[col * Cols + k] /= diagonal;
+                    }
+                    for (size_t row = 0; row < Rows; row++) {
+                        if (row == col) {
+                            continue;
+                        }
+                        T factor = m[row * Cols + col];
+                        for (size_t k = 0; k < Cols; k++) {
+                            m[row * Cols + k] -= factor * m[col * Cols + k];
+                            inv[row * Cols + k] -= factor * inv[col * Cols + k];
+                        }
+                    }
+                }
+                return Mat<T, Rows, Cols>(inv);
+            }
+        }
+
+        // Get the value at the given row and column
+        constexpr T Get(size_t row, size_t col) const { return values[row * Cols + col]; }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(
+            std::ostream& stream, const Mat<T, Rows, Cols>& mat) {
+            stream << "{";
+            for (size_t row = 0; row < Rows; row++) {
+                stream << "{";
+                for (size_t col = 0; col < Cols - 1; col++) {
+                    stream << mat.Get(row, col) << ", ";
+                }
+                stream << mat.Get(row, Cols - 1) << (row < Rows - 1 ? "}, " : "}");
+            }
+            stream << "}";
+            return stream;
+        }
+
+    private:
+
+        template<typename, size_t, size_t>
+        friend class Mat;
+
+        // Construct directly from row-major storage
+        constexpr explicit Mat(const std::array<T, Rows * Cols>& values) : values(values) {}
+
+        // Row i, column j of the product is the dot of row i and column j,
+        // expanded at compile time for every output element
+        template<size_t N, size_t Index, size_t... K>
+        constexpr T DotRowCol(const Mat<T, Cols, N>& other, std::index_sequence<K...>) const {
+            return ((values[(Index / N) * Cols + K] * other.values[K * N + Index % N]) + ...);
+        }
+
+        template<size_t N, size_t... Index>
+        constexpr Mat<T, Rows, N> MultiplyImpl(
+            const Mat<T, Cols, N>& other, std::index_sequence<Index...>) const {
+            return Mat<T, Rows, N>(std::array<T, Rows * N>{ {
+                DotRowCol<N, Index>(other, std::make_index_sequence<Cols>())... } });
+        }
+
+        template<size_t... Index>
+        constexpr Mat<T, Cols, Rows> TransposeImpl(std::index_sequence<Index...>) const {
+            return Mat<T, Cols, Rows>(std::array<T, Rows * Cols>{ {
+                values[(Index % Rows) * Cols + Index / Rows]... } });
+        }
+
+        template<size_t... Index>
+        constexpr Mat<T, Rows, Cols> ScaleImpl(T scalar, std::index_sequence<Index...>) const {
+            return Mat<T, Rows, Cols>(std::array<T, Rows * Cols>{ {
+                (values[Index] * scalar)... } });
+        }
+
+        template<size_t... Index>
+        static constexpr Mat<T, Rows, Cols> IdentityImpl(std::index_sequence<Index...>) {
+            return Mat<T, Rows, Cols>(std::array<T, Rows * Cols>{ {
+                T(Index / Cols == Index % Cols ? 1 : 0)... } });
+        }
+
+        // Index of the row at or below col with the largest magnitude in col
+        static constexpr size_t FindPivot(const std::array<T, Rows * Cols>& m, size_t col) {
+            size_t pivot = col;
+            T best = m[col * Cols + col] < T(0) ? -m[col * Cols + col] : m[col * Cols + col];
+            for (size_t row = col + 1; row < Rows; row++) {
+                T value = m[row * Cols + col] < T(0) ? -m[row * Cols + col] : m[row * Cols + col];
+                if (value > best) {
+                    best = value;
+                    pivot = row;
+                }
+            }
+            return pivot;
+        }
+
+        static constexpr void SwapRows(std::array<T, Rows * Cols>& m, size_t first, size_t second) {
+            for (size_t k = 0; k < Cols; k++) {
+                T temp = m[first * Cols + k];
+                m[first * Cols + k] = m[second * Cols + k];
+                m[second * Cols + k] = temp;
+            }
+        }
+
+        std::array<T, Rows * Cols> values;
+
+    };
+
+    template<typename T, size_t Rows, size_t Cols>
+    constexpr Mat<T, Rows, Cols> Mat<T, Rows, Cols>::Identity =
+        Mat<T, Rows, Cols>::IdentityImpl(std::make_index_sequence<Rows * Cols>());
+
+}
@@ -12,31 +12,31 @@ namespace Math {
 
     public:
 
-        static const Mat2<T> Identity = Mat2<T>(1, 0, 0, 1);
+        static const Mat2<T> Identity;
 
         // Empty constructor
         Mat2() = delete;
 
         // Constructor
-        Mat2(T a, T b, T c, T d) : a(a), b(b), c(c), d(d) {}
+        constexpr Mat2(T a, T b, T c, T d) : a(a), b(b), c(c), d(d) {}
 
         // Copy constructor
-        Mat2(const Mat2<T>& other) = default;
+        constexpr Mat2(const Mat2<T>& other) = default;
 
         // Move contstructor
-        Mat2(Mat2&& other) = default;
+        constexpr Mat2(Mat2&& other) = default;
 
         // Destructor
         ~Mat2() = default;
 
         // Copy assignment
-        Mat2& operator=(const Mat2& other) = default;
+        constexpr Mat2& operator=(const Mat2& other) = default;
 
         // Move assignment
-        Mat2& operator=(Mat2&& other) = default;
+        constexpr Mat2& operator=(Mat2&& other) = default;
 
         // Const Multiply by other 2x2 Matrix
-        Mat2<T> Multiply(const Mat2<T>& other) const {
+        constexpr Mat2<T> Multiply(const Mat2<T>& other) const {
             return Mat2<T>(
                 a * other.a + b * other.c,
                 a * other.b + b * other.d,
@@ -45,19 +45,19 @@ namespace Math {
         }
 
         // Const Multiply by Vec2
-        Vec2<T> Multiply(const Vec2<T>& other) const {
+        constexpr Vec2<T> Multiply(const Vec2<T>& other) const {
             return Vec2<T>(
-                a * other.x + b * other.y,
-                c * other.x + d * other.y);
+                a * other.GetX() + b * other.GetY(),
+                c * other.GetX() + d * other.GetY());
         }
 
         // Const Transpose
-        Mat2<T> Transpose() const {
+        constexpr Mat2<T> Transpose() const {
             return Mat2<T>(a, c, b, d);
         }
 
         // Const Scale
-        Mat2<T> Scale(T scalar) const {
+        constexpr Mat2<T> Scale(T scalar) const {
             return Mat2<T>(
                 a * scalar,
                 b * scalar,
@@ -67,16 +67,20 @@ namespace Math {
 
 
         // Mutator Multiply by other 2x2 Matrix
-        Mat2<T> Multiply(const Mat2<T>& other) {
-            a = a * other.a + b * other.c;
+        constexpr Mat2<T> Multiply(const Mat2<T>& other) {
+            auto A = a * other.a + b * other.c;
             b = a * other.b + b * other.d;
-            c = c * other.a + d * other.c;
+            auto C = c * other.a + d * other.c;
             d = c * other.b + d * other.d;
+
+            a = A;
+            c = C;
+
             return *this;
         }
 
         // Mutator Transpose
-        Mat2<T> Transpose() {
+        constexpr Mat2<T> Transpose() {
             auto temp = b;
             b = c;
             c = temp;
@@ -84,7 +88,7 @@ namespace Math {
         }
 
         // Mutator Scale
-        Mat2<T> Scale(T scalar) {
+        constexpr Mat2<T> Scale(T scalar) {
             a *= scalar;
             b *= scalar;
             c *= scalar;
@@ -94,12 +98,12 @@ namespace Math {
 
 
         // Get the determinant of this matrix
-        T Determinant() const {
+        constexpr T Determinant() const {
             return a * d - b * c;
         }
 
         // Get the inverse of this matrix
-        Mat2<T> Inverse() const {
+        constexpr Mat2<T> Inverse() const {
             auto det = a * d - b * c;
             if (det == 0) {
                 throw MatrixException(MatrixError::NOT_INVERTIBLE);
@@ -112,13 +116,13 @@ namespace Math {
         }
 
         // Solve for x in the equation Ax = b
-        Vec2<T> Solve(const Vec2<T>& bVec) const {
+        constexpr Vec2<T> Solve(const Vec2<T>& bVec) const {
             auto det = a * d - b * c;
             if (det == 0) {
                 throw MatrixException(MatrixError::NOT_INVERTIBLE);
             }
-            auto xOverDet = bVec.x / det;
-            auto yOverDet = bVec.y / det;
+            auto xOverDet = bVec.GetX() / det;
+            auto yOverDet = bVec.GetY() / det;
             return Vec2<T>(
                 d * xOverDet - b * yOverDet,
                 a * yOverDet - c * xOverDet);
@@ -138,4 +142,7 @@ namespace Math {
 
     };
 
+    template<typename T>
+    constexpr Mat2<T> Mat2<T>::Identity(1, 0, 0, 1);
+
 }
@@ -12,16 +12,13 @@ namespace Math {
 
     public:
 
-        static const Mat3<T> Identity = Mat3<T>(
-            1, 0, 0,
-            0, 1, 0,
-            0, 0, 1);
+        static const Mat3<T> Identity;
 
         // Empty constructor
         Mat3() = delete;
 
         // Default constructor
-        Mat3(
+        constexpr Mat3(
             T a, T b, T c,
             T d, T e, T f,
             T g, T h, T i) :
@@ -30,23 +27,23 @@ namespace Math {
             g(g), h(h), i(i) {}
 
         // Copy constructor
-        Mat3(const Mat3<T>& other) = default;
+        constexpr Mat3(const Mat3<T>& other) = default;
 
         // Move contstructor
-        Mat3(Mat3&& other) = default;
+        constexpr Mat3(Mat3&& other) = default;
 
         // Destructor
         ~Mat3() = default;
 
         // Copy assignment
-        Mat3& operator=(const Mat3& other) = default;
+        constexpr Mat3& operator=(const Mat3& other) = default;
 
         // Move assignment
-        Mat3& operator=(Mat3&& other) = default;
+        constexpr Mat3& operator=(Mat3&& other) = default;
 
 
-        // Const Muliply by other 2x2 Matrix
-        Mat3<T> Multiply(const Mat3<T>& other) const {
+        // Const Multiply by other 3x3 Matrix
+        constexpr Mat3<T> Multiply(const Mat3<T>& other) const {
             return Mat3<T>(
                 a * other.a + b * other.d + c * other.g, a * other.b + b * other.e + c * other.h, a * other.c + b * other.f + c * other.i,
                 d * other.a + e * other.d + f * other.g, d * other.b + e * other.e + f * other.h, d * other.c + e * other.f + f * other.i,
@@ -54,15 +51,15 @@ namespace Math {
         }
 
         // Const Multiply by Vec3
-        Vec3<T> Multiply(const Vec3<T>& other) const {
+        constexpr Vec3<T> Multiply(const Vec3<T>& other) const {
             return Vec3<T>(
-                a * other.x + b * other.y, c * other.z,
-                d * other.x + e * other.y, f * other.z,
-                g * other.x + h * other.y, i * other.z);
+                a * other.GetX() + b * other.GetY() + c * other.GetZ(),
+                d * other.GetX() + e * other.GetY() + f * other.GetZ(),
+                g * other.GetX() + h * other.GetY() + i * other.GetZ());
         }
 
         // Const Transpose
-        Mat3<T> Transpose() const {
+        constexpr Mat3<T> Transpose() const {
             return Mat3<T>(
                 a, d, g,
                 b, e, h,
@@ -70,7 +67,7 @@ namespace Math {
         }
 
         // Const Scale
-        Mat3<T> Scale(T scalar) const {
+        constexpr Mat3<T> Scale(T scalar) const {
             return Mat3<T>(
                 a * scalar, b * scalar, c * scalar,
                 d * scalar, e * scalar, f * scalar,
@@ -78,8 +75,8 @@ namespace Math {
         }
 
 
-        // Mutator Muliply by other 2x2 Matrix
-        Mat3<T> Multiply(const Mat3<T>& other) {
+        // Mutator Multiply by other 3x3 Matrix
+        constexpr Mat3<T> Multiply(const Mat3<T>& other) {
             auto A = a * other.a + b * other.d + c * other.g;
             auto B = a * other.b + b * other.e + c * other.h;
             c = a * other.c + b * other.f + c * other.i;
@@ -101,7 +98,7 @@ namespace Math {
         }
 
         // Mutator Transpose
-        Mat3<T> Transpose() {
+        constexpr Mat3<T> Transpose() {
             auto temp = d;
             d = b;
             b = temp;
@@ -116,7 +113,7 @@ namespace Math {
         }
 
         // Mutator Scale
-        Mat3<T> Scale(T scalar) {
+        constexpr Mat3<T> Scale(T scalar) {
             a *= scalar;
             b *= scalar;
             c *= scalar;
@@ -131,12 +128,12 @@ namespace Math {
 
 
         // Get the determinant of this matrix
-        T Determinant() const {
+        constexpr T Determinant() const {
             return a * (e * i - f * h) - b * (d * i - f * g) + c * (d * h - e * g);
         }
 
         // Get the inverse of this matrix
-        Mat3<T> Inverse() const {
+        constexpr Mat3<T> Inverse() const {
             auto det = a * (e * i - f * h) - b * (d * i - f * g) + c * (d * h - e * g);
             if (det == 0) {
                 throw MatrixException(MatrixError::NOT_INVERTIBLE);
@@ -148,14 +145,14 @@ namespace Math {
         }
 
         // Solve for x in the equation Ax = b
-        Vec3<T> Solve(const Vec3<T>& bVec) const {
+        constexpr Vec3<T> Solve(const Vec3<T>& bVec) const {
             auto det = a * (e * i - f * h) - b * (d * i - f * g) + c * (d * h - e * g);
             if (det == 0) {
                 throw MatrixException(MatrixError::NOT_INVERTIBLE);
             }
-            auto xOverDet = bVec.x / det;
-            auto yOverDet = bVec.y / det;
-            auto zOverDet = bVec.z / det;
+            auto xOverDet = bVec.GetX() / det;
+            auto yOverDet = bVec.GetY() / det;
+            auto zOverDet = bVec.GetZ() / det;
             return Vec3<T>(
                 ((e * i - f * h) * xOverDet) + ((c * h - b * i) * yOverDet) + ((b * f - c * e) * zOverDet),
                 ((f * g - d * i) * xOverDet) + ((a * i - c * g) * yOverDet) + ((c * d - a * f) * zOverDet),
@@ -164,7 +161,7 @@ namespace Math {
 
         // Overload stream insertion for pretty printing
         inline friend std::ostream& operator<<(
-            std::ostream& stream, const Mat2<T>& mat) {
+            std::ostream& stream, const Mat3<T>& mat) {
             stream << "{{" << mat.a << ", " << mat.b << ", " << mat.c << "}, "
                 << "{" << mat.d << ", " << mat.e << ", " << mat.f << "}, "
                 << "{" << mat.g << ", " << mat.h << ", " << mat.i << "}}";
@@ -177,4 +174,10 @@ namespace Math {
 
     };
 
+    template<typename T>
+    constexpr Mat3<T> Mat3<T>::Identity(
+        1, 0, 0,
+        0, 1, 0,
+        0, 0, 1);
+
 }
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+
+namespace Math {
+
+    // Philox4x32-10 counter-based generator (Salmon et al., "Parallel random
+    // numbers: as easy as 1, 2, 3"). Each block of four 32-bit words is a pure
+    // function of (seed, stream, counter), so any block can be computed
+    // directly: jumping ahead is setting the counter, and threads that use
+    // their own stream, or disjoint counter ranges, get reproducible results
+    // no matter how the work is scheduled.
+    class Philox {
+
+    public:
+
+        using Block = std::array<uint32_t, 4>;
+
+        // Empty constructor
+        Philox() = delete;
+
+        // Default constructor
+        constexpr Philox(uint64_t seed, uint64_t stream = 0, uint64_t counter = 0) :
+            seed(seed), stream(stream), counter(counter) {}
+
+        // Copy constructor
+        constexpr Philox(const Philox& other) = default;
+
+        // Move contstructor
+        constexpr Philox(Philox&& other) = default;
+
+        // Destructor
+        ~Philox() = default;
+
+        // Copy assignment
+        constexpr Philox& operator=(const Philox& other) = default;
+
+        // Move assignment
+        constexpr Philox& operator=(Philox&& other) = default;
+
+        // Get the block at the given counter
+        constexpr Block Generate(uint64_t at) const {
+            uint32_t key0 = uint32_t(seed);
+            uint32_t key1 = uint32_t(seed >> 32);
+            Block block{ { uint32_t(at), uint32_t(at >> 32), uint32_t(stream), uint32_t(stream >> 32) } };
+            for (int round = 0; round < 10; round++) {
+                uint64_t first = uint64_t(0xD2511F53u) * block[0];
+                uint64_t second = uint64_t(0xCD9E8D57u) * block[2];
+                block = Block{ {
+                    uint32_t(second >> 32) ^ block[1] ^ key0, uint32_t(second),
+                    uint32_t(first >> 32) ^ block[3] ^ key1, uint32_t(first) } };
+                key0 += 0x9E3779B9u;
+                key1 += 0xBB67AE85u;
+            }
+            return block;
+        }
+
+        // Get a generator for another stream with the same seed, starting at counter 0
+        constexpr Philox Stream(uint64_t index) const {
+            return Philox(seed, index);
+        }
+
+
+        // Mutator Next, the block at the current counter, advancing past it
+        constexpr Block Next() {
+            return Generate(counter++);
+        }
+
+        // Mutator Discard, skip ahead by count blocks
+        constexpr Philox Discard(uint64_t count) {
+            counter += count;
+            return *this;
+        }
+
+
+        constexpr uint64_t GetSeed() const { return seed; }
+
+        constexpr uint64_t GetStream() const { return stream; }
+
+        constexpr uint64_t GetCounter() const { return counter; }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(std::ostream& out, const Philox& philox) {
+            out << "{seed: " << philox.seed << ", stream: " << philox.stream
+                << ", counter: " << philox.counter << "}";
+            return out;
+        }
+
+    private:
+
+        uint64_t seed;
+        uint64_t stream;
+        uint64_t counter;
+
+    };
+
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "Philox.h"
+#include "../FastMath.h"
+#include "../Vec2.h"
+#include "../Vec3.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Math {
+
+    // Batched random sampling on top of Philox. out[i] is sample first + i of
+    // the stream, drawn from the block at generator counter + (first + i) /
+    // PerBlock, where PerBlock is the number of samples one block of four
+    // words yields. A batch can therefore be split across threads, each chunk
+    // passing the index of its first sample, and give the same values as a
+    // single call.
+    //
+    // Directions are built directly from uniform numbers (the sphere from a
+    // uniform height and angle, the hemisphere by mirroring into the half
+    // space of the normal), which is exact in distribution and avoids both
+    // rejection loops and normalizing random triples. The trigonometric and
+    // logarithm and square root steps use FastMath at the requested accuracy.
+    namespace Sample {
+
+        namespace Detail {
+
+            // Uniform in [0, 1)
+            inline float Unit(uint32_t word) {
+                return float(word >> 8) * 5.9604644775390625e-8f;
+            }
+
+            // Uniform in (0, 1]
+            inline float OpenUnit(uint32_t word) {
+                return float((word >> 8) + 1) * 5.9604644775390625e-8f;
+            }
+
+            // Uniform in [-1, 1)
+            inline float SignedUnit(uint32_t word) {
+                return float(int32_t(word) >> 8) * 1.1920928955078125e-7f;
+            }
+
+            // Two independent standard normal values from two words (Box-Muller)
+            template<FastMath::Accuracy A>
+            inline void Gaussian(uint32_t first, uint32_t second, float& x, float& y) {
+                float radius = FastMath::Sqrt<A>(-2.0f * FastMath::Log<A>(OpenUnit(first)));
+                float sin, cos;
+                FastMath::SinCos<A>(3.14159265358979f * SignedUnit(second), sin, cos);
+                x = radius * cos;
+                y = radius * sin;
+            }
+
+            // Uniform direction on the unit sphere from two words
+            template<FastMath::Accuracy A>
+            inline Vec3<float> Sphere(uint32_t first, uint32_t second) {
+                float z = SignedUnit(first);
+                float radius = FastMath::Sqrt<A>(1.0f - z * z);
+                float sin, cos;
+                FastMath::SinCos<A>(3.14159265358979f * SignedUnit(second), sin, cos);
+                return Vec3<float>(radius * cos, radius * sin, z);
+            }
+
+            // Call emit(index, words) for index in [0, count), where the words of
+            // sample first + index start at word ((first + index) % PerBlock) *
+            // (4 / PerBlock) of block (first + index) / PerBlock. Whole blocks
+            // run in a loop without branches so emit can vectorize.
+            template<size_t PerBlock, typename Emit>
+            void Fill(const Philox& generator, uint64_t first, size_t count, Emit emit) {
+                constexpr size_t Words = 4 / PerBlock;
+                uint64_t base = generator.GetCounter();
+                size_t index = 0;
+                while (index < count && (first + index) % PerBlock != 0) {
+                    uint64_t sample = first + index;
+                    Philox::Block block = generator.Generate(base + sample / PerBlock);
+                    emit(index, block.data() + (sample % PerBlock) * Words);
+                    index++;
+                }
+                size_t blocks = (count - index) / PerBlock;
+                uint64_t firstBlock = base + (first + index) / PerBlock;
+                for (size_t block = 0; block < blocks; block++) {
+                    Philox::Block words = generator.Generate(firstBlock + block);
+                    for (size_t lane = 0; lane < PerBlock; lane++) {
+                        emit(index + block * PerBlock + lane, words.data() + lane * Words);
+                    }
+                }
+                index += blocks * PerBlock;
+                for (; index < count; index++) {
+                    uint64_t sample = first + index;
+                    Philox::Block block = generator.Generate(base + sample / PerBlock);
+                    emit(index, block.data() + (sample % PerBlock) * Words);
+                }
+            }
+
+        }
+
+        // out[i] uniform in [low, high)
+        inline void Uniform(
+            const Philox& generator, uint64_t first, float* out, size_t count,
+            float low = 0.0f, float high = 1.0f) {
+            float range = high - low;
+            Detail::Fill<4>(generator, first, count, [=](size_t index, const uint32_t* words) {
+                out[index] = low + range * Detail::Unit(words[0]);
+            });
+        }
+
+        // out[i] uniform in the box [min, max)
+        inline void Uniform(
+            const Philox& generator, uint64_t first, Vec2<float>* out, size_t count,
+            const Vec2<float>& min, const Vec2<float>& max) {
+            float x = min.GetX(), y = min.GetY();
+            float width = max.GetX() - x, height = max.GetY() - y;
+            Detail::Fill<2>(generator, first, count, [=](size_t index, const uint32_t* words) {
+                out[index] = Vec2<float>(
+                    x + width * Detail::Unit(words[0]), y + height * Detail::Unit(words[1]));
+            });
+        }
+
+        // out[i] uniform in the box [min, max)
+        inline void Uniform(
+            const Philox& generator, uint64_t first, Vec3<float>* out, size_t count,
+            const Vec3<float>& min, const Vec3<float>& max) {
+            float x = min.GetX(), y = min.GetY(), z = min.GetZ();
+            float width = max.GetX() - x, height = max.GetY() - y, depth = max.GetZ() - z;
+            Detail::Fill<1>(generator, first, count, [=](size_t index, const uint32_t* words) {
+                out[index] = Vec3<float>(
+                    x + width * Detail::Unit(words[0]), y + height * Detail::Unit(words[1]),
+                    z + depth * Detail::Unit(words[2]));
+            });
+        }
+
+        // out[i] normally distributed with the given mean and standard deviation
+        template<FastMath::Accuracy A = FastMath::Accuracy::PRECISE>
+        void Gaussian(
+            const Philox& generator, uint64_t first, float* out, size_t count,
+            float mean = 0.0f, float deviation = 1.0f) {
+            Detail::Fill<2>(generator, first, count, [=](size_t index, const uint32_t* words) {
+                float x, y;
+                Detail::Gaussian<A>(words[0], words[1], x, y);
+                out[index] = mean + deviation * x;
+            });
+        }
+
+        // out[i] = mean + deviation * (independent standard normal per component)
+        template<FastMath::Accuracy A = FastMath::Accuracy::PRECISE>
+        void Gaussian(
+            const Philox& generator, uint64_t first, Vec2<float>* out, size_t count,
+            const Vec2<float>& mean, float deviation = 1.0f) {
+            Detail::Fill<2>(generator, first, count, [=](size_t index, const uint32_t* words) {
+                float x, y;
+                Detail::Gaussian<A>(words[0], words[1], x, y);
+                out[index] = Vec2<float>(mean.GetX() + deviation * x, mean.GetY() + deviation * y);
+            });
+        }
+
+        // out[i] = mean + deviation * (independent standard normal per component)
+        template<FastMath::Accuracy A = FastMath::Accuracy::PRECISE>
+        void Gaussian(
+            const Philox& generator, uint64_t first, Vec3<float>* out, size_t count,
+            const Vec3<float>& mean, float deviation = 1.0f) {
+            Detail::Fill<1>(generator, first, count, [=](size_t index, const uint32_t* words) {
+                float x, y, z, unused;
+                Detail::Gaussian<A>(words[0], words[1], x, y);
+                Detail::Gaussian<A>(words[2], words[3], z, unused);
+                out[index] = Vec3<float>(
+                    mean.GetX() + deviation * x, mean.GetY() + deviation * y, mean.GetZ() + deviation * z);
+            });
+        }
+
+        // out[i] uniform on the unit circle
+        template<FastMath::Accuracy A = FastMath::Accuracy::PRECISE>
+        void Circle(const Philox& generator, uint64_t first, Vec2<float>* out, size_t count) {
+            Detail::Fill<4>(generator, first, count, [=](size_t index, const uint32_t* words) {
+                float sin, cos;
+                FastMath::SinCos<A>(3.14159265358979f * Detail::SignedUnit(words[0]), sin, cos);
+                out[index] = Vec2<float>(cos, sin);
+            });
+        }
+
+        // out[i] uniform on the unit sphere
+        template<FastMath::Accuracy A = FastMath::Accuracy::PRECISE>
+        void Sphere(const Philox& generator, uint64_t first, Vec3<float>* out, size_t count) {
+            Detail::Fill<2>(generator, first, count, [=](size_t index, const uint32_t* words) {
+                out[index] = Detail::Sphere<A>(words[0], words[1]);
+            });
+        }
+
+        // out[i] uniform on the unit hemisphere around normal, which need not be unit length
+        template<FastMath::Accuracy A = FastMath::Accuracy::PRECISE>
+        void Hemisphere(
+            const Philox& generator, uint64_t first, Vec3<float>* out, size_t count,
+            const Vec3<float>& normal) {
+            Detail::Fill<2>(generator, first, count, [=](size_t index, const uint32_t* words) {
+                using namespace FastMath::Detail;
+                const Vec3<float> direction = Detail::Sphere<A>(words[0], words[1]);
+                // Mirror directions below the plane through the origin, the
+                // sign is taken from the bits so no comparison is needed
+                float sign = FromBits(Bits(1.0f) | (Bits(direction.Dot(normal)) & 0x80000000u));
+                out[index] = direction.Scale(sign);
+            });
+        }
+
+    }
+
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Config.h"
+
+#include <cstddef>
+
+namespace Math {
+
+    namespace Reduce {
+
+        // Number of interleaved accumulators used inside a block. Lane j sums
+        // the elements whose index is j modulo BlockLanes, and the lanes are
+        // then combined pairwise. The order is fixed by the source rather than
+        // the instruction set, yet the lanes map directly onto SIMD registers.
+        constexpr size_t BlockLanes = 8;
+
+        // Combine the block accumulators pairwise in a fixed order
+        template<typename T>
+        inline T CombineLanes(const T (&lanes)[BlockLanes]) {
+            return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3]))
+                + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+        }
+
+        // Sum one block of values in a fixed order
+        template<typename T>
+        inline T BlockSum(const T* values, size_t count) {
+            T lanes[BlockLanes] = {};
+            size_t index = 0;
+            for (; index + BlockLanes <= count; index += BlockLanes) {
+                for (size_t lane = 0; lane < BlockLanes; lane++) {
+                    lanes[lane] += values[index + lane];
+                }
+            }
+            size_t tail = count - index;
+            for (size_t lane = 0; lane < BlockLanes && lane < tail; lane++) {
+                lanes[lane] += values[index + lane];
+            }
+            return CombineLanes(lanes);
+        }
+
+        // Dot product of one block of values in a fixed order
+        template<typename T>
+        inline T BlockDot(const T* first, const T* second, size_t count) {
+            T lanes[BlockLanes] = {};
+            size_t index = 0;
+            for (; index + BlockLanes <= count; index += BlockLanes) {
+                for (size_t lane = 0; lane < BlockLanes; lane++) {
+                    lanes[lane] += first[index + lane] * second[index + lane];
+                }
+            }
+            size_t tail = count - index;
+            for (size_t lane = 0; lane < BlockLanes && lane < tail; lane++) {
+                lanes[lane] += first[index + lane] * second[index + lane];
+            }
+            return CombineLanes(lanes);
+        }
+
+        // Combine blocks [firstBlock, firstBlock + blocks) with a balanced tree
+        // that splits at the largest power of two below blocks, so the shape of
+        // the tree depends only on the number of blocks
+        template<typename T, typename BlockFunction>
+        inline T Tree(size_t firstBlock, size_t blocks, const BlockFunction& block) {
+            if (blocks == 1) {
+                return block(firstBlock);
+            }
+            size_t half = 1;
+            while (half * 2 < blocks) {
+                half *= 2;
+            }
+            return Tree<T>(firstBlock, half, block) + Tree<T>(firstBlock + half, blocks - half, block);
+        }
+
+        // Combine per-block partial sums exactly as Sum does in deterministic
+        // mode. A parallel caller that computes BlockSum for every
+        // ReductionBlockSize block, on any number of threads, gets the same
+        // bits by passing those partials here.
+        template<typename T>
+        inline T TreeSum(const T* partials, size_t count) {
+            if (count == 0) {
+                return T(0);
+            }
+            return Tree<T>(0, count, [partials](size_t block) { return partials[block]; });
+        }
+
+        // Sum of all values. In deterministic mode this is the tree sum of
+        // ReductionBlockSize blocks. Otherwise the whole array is one block,
+        // which skips the tree, and the summation order may differ between
+        // builds.
+        template<typename T>
+        inline T Sum(const T* values, size_t count) {
+            if constexpr (Deterministic) {
+                if (count == 0) {
+                    return T(0);
+                }
+                size_t blocks = (count + ReductionBlockSize - 1) / ReductionBlockSize;
+                return Tree<T>(0, blocks, [values, count](size_t block) {
+                    size_t begin = block * ReductionBlockSize;
+                    size_t length = count - begin < ReductionBlockSize ? count - begin : ReductionBlockSize;
+                    return BlockSum(values + begin, length);
+                });
+            }
+            else {
+                return BlockSum(values, count);
+            }
+        }
+
+        // Dot product of two arrays, reduced the same way as Sum
+        template<typename T>
+        inline T Dot(const T* first, const T* second, size_t count) {
+            if constexpr (Deterministic) {
+                if (count == 0) {
+                    return T(0);
+                }
+                size_t blocks = (count + ReductionBlockSize - 1) / ReductionBlockSize;
+                return Tree<T>(0, blocks, [first, second, count](size_t block) {
+                    size_t begin = block * ReductionBlockSize;
+                    size_t length = count - begin < ReductionBlockSize ? count - begin : ReductionBlockSize;
+                    return BlockDot(first + begin, second + begin, length);
+                });
+            }
+            else {
+                return BlockDot(first, second, count);
+            }
+        }
+
+    }
+
+}
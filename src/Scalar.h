@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Config.h"
+
+#include <cmath>
+#include <type_traits>
+
+namespace Math {
+
+    // Floor of the square root of an unsigned integer, computed exactly one
+    // bit at a time so the result never depends on floating point hardware
+    template<typename U>
+    constexpr U ISqrt(U value) {
+        U result = 0;
+        U bit = U(1) << (sizeof(U) * 8 - 2);
+        while (bit > value) {
+            bit >>= 2;
+        }
+        while (bit != 0) {
+            if (value >= result + bit) {
+                value -= result + bit;
+                result = (result >> 1) + bit;
+            }
+            else {
+                result >>= 1;
+            }
+            bit >>= 2;
+        }
+        return result;
+    }
+
+    // Square root used by the Vec and Mat templates. Floating point types use
+    // std::sqrt, integer types use the exact ISqrt (negative values give 0),
+    // and other scalar types such as Fixed provide their own Sqrt found by
+    // argument dependent lookup.
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    inline T Sqrt(T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return std::sqrt(value);
+        }
+        else {
+            using U = std::make_unsigned_t<T>;
+            return value <= T(0) ? T(0) : T(ISqrt(U(value)));
+        }
+    }
+
+}
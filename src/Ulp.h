@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Vec.h"
+#include "Vec2.h"
+#include "Vec3.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace Math {
+
+    // Spacing of T around magnitude, the smallest subnormal step for 0
+    template<typename T>
+    long double Ulp(long double magnitude) {
+        static_assert(std::is_floating_point_v<T>, "Ulp needs a floating point type");
+        int exponent = std::numeric_limits<T>::min_exponent;
+        if (magnitude != 0.0L) {
+            std::frexp(magnitude, &exponent);
+            exponent = std::max(exponent, std::numeric_limits<T>::min_exponent);
+        }
+        return std::ldexp(1.0L, exponent - std::numeric_limits<T>::digits);
+    }
+
+    // Error in ulps of magnitude rather than of the reference, for results
+    // that may cancel. Pass the scale the rounding errors grow with, such as
+    // the sum of |x[i] * y[i]| for a dot product, so the error stays bounded
+    // when the exact result is tiny.
+    template<typename T>
+    long double UlpError(T value, long double reference, long double magnitude) {
+        static_assert(std::is_floating_point_v<T>, "UlpError needs a floating point type");
+        if (std::isnan(value) || std::isnan(reference)) {
+            return std::isnan(value) && std::isnan(reference) ? 0.0L : std::numeric_limits<long double>::infinity();
+        }
+        if (std::isinf(value) || std::isinf(reference)) {
+            return value == reference ? 0.0L : std::numeric_limits<long double>::infinity();
+        }
+        long double scale = std::max(std::fabs(reference), std::fabs(magnitude));
+        return std::fabs(static_cast<long double>(value) - reference) / Ulp<T>(scale);
+    }
+
+    // Error of a float or double result in units in the last place of a
+    // higher precision reference, as used for the error budgets in
+    // FastMath.h. The ulp is the spacing of T around the reference, so the
+    // error is fractional and stays meaningful for subnormal and zero results.
+    template<typename T>
+    long double UlpError(T value, long double reference) {
+        return UlpError(value, reference, reference);
+    }
+
+    // Number of representable values between first and second, 0 when they
+    // are equal (including 0 and -0), and the maximum when either is NaN
+    template<typename T>
+    uint64_t UlpDistance(T first, T second) {
+        static_assert(std::is_floating_point_v<T> && (sizeof(T) == 4 || sizeof(T) == 8),
+            "UlpDistance needs float or double");
+        using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+        if (std::isnan(first) || std::isnan(second)) {
+            return UINT64_MAX;
+        }
+        // Map the sign magnitude bit patterns onto one increasing scale
+        auto order = [](T value) {
+            Bits bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            constexpr Bits sign = Bits(1) << (sizeof(Bits) * 8 - 1);
+            return (bits & sign) ? sign - (bits & ~sign) : sign + bits;
+        };
+        Bits a = order(first), b = order(second);
+        return a > b ? uint64_t(a - b) : uint64_t(b - a);
+    }
+
+    // Accumulates the maximum and mean ulp error of many results against
+    // their references, and which result had the largest error
+    template<typename T>
+    class UlpStats {
+
+    public:
+
+        // Default constructor
+        UlpStats() = default;
+
+        // Copy constructor
+        UlpStats(const UlpStats& other) = default;
+
+        // Move contstructor
+        UlpStats(UlpStats&& other) = default;
+
+        // Destructor
+        ~UlpStats() = default;
+
+        // Copy assignment
+        UlpStats& operator=(const UlpStats& other) = default;
+
+        // Move assignment
+        UlpStats& operator=(UlpStats&& other) = default;
+
+        // Add one result, returns its error in ulps
+        long double Add(T value, long double reference) {
+            return Add(value, reference, reference);
+        }
+
+        // Add one result that may cancel, with its error in ulps of magnitude
+        long double Add(T value, long double reference, long double magnitude) {
+            long double error = UlpError(value, reference, magnitude);
+            if (count == 0 || error > max) {
+                max = error;
+                worst = count;
+            }
+            sum += error;
+            count++;
+            return error;
+        }
+
+        // Add each component of a Vec2 result
+        long double Add(const Vec2<T>& value, const Vec2<long double>& reference) {
+            return std::max(Add(value.GetX(), reference.GetX()), Add(value.GetY(), reference.GetY()));
+        }
+
+        // Add each component of a Vec3 result
+        long double Add(const Vec3<T>& value, const Vec3<long double>& reference) {
+            long double error = std::max(Add(value.GetX(), reference.GetX()), Add(value.GetY(), reference.GetY()));
+            return std::max(error, Add(value.GetZ(), reference.GetZ()));
+        }
+
+        // Add each component of a Vec result
+        template<size_t N>
+        long double Add(const Vec<T, N>& value, const Vec<long double, N>& reference) {
+            long double error = 0;
+            for (size_t index = 0; index < N; index++) {
+                error = std::max(error, Add(value[int(index)], reference[int(index)]));
+            }
+            return error;
+        }
+
+        // Add count results at once
+        void Add(const T* values, const long double* references, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                Add(values[index], references[index]);
+            }
+        }
+
+        // Combine with statistics gathered elsewhere, e.g. on another thread,
+        // as if other's results had been added after this one's
+        void Merge(const UlpStats& other) {
+            if (other.count != 0 && (count == 0 || other.max > max)) {
+                max = other.max;
+                worst = count + other.worst;
+            }
+            sum += other.sum;
+            count += other.count;
+        }
+
+        // Whether the maximum and mean errors are within a budget
+        bool Within(long double maxBudget, long double meanBudget) const {
+            return max <= maxBudget && GetMean() <= meanBudget;
+        }
+
+        long double GetMax() const { return max; }
+
+        long double GetMean() const { return count == 0 ? 0.0L : sum / count; }
+
+        size_t GetCount() const { return count; }
+
+        // Get the position, in order of addition, of the result with the largest error
+        size_t GetWorst() const { return worst; }
+
+        // Overload stream insertion for pretty printing
+        inline friend std::ostream& operator<<(std::ostream& stream, const UlpStats& stats) {
+            stream << "{max " << double(stats.max) << " ulp, mean " << double(stats.GetMean())
+                << " ulp, " << stats.count << " results}";
+            return stream;
+        }
+
+    private:
+
+        long double max = 0;
+        long double sum = 0;
+        size_t count = 0;
+        size_t worst = 0;
+
+    };
+
+}
@@ -1,13 +1,16 @@
 #pragma once
 
 #include "Exception/VectorException.h"
+#include "Scalar.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <initializer_list>
 #include <memory>
 #include <ostream>
-#include <vector>
+#include <type_traits>
 
 namespace Math {
 
@@ -20,10 +23,18 @@ namespace Math {
         Vec() = delete;
 
         // Default constructor
-        Vec(T values...) : Size(Size), values(values) {}
+        template<typename... Values, typename = std::enable_if_t<
+            sizeof...(Values) == Size && (std::is_convertible_v<Values, T> && ...)>>
+        constexpr Vec(Values... values) : values{ { T(values)... } } {}
 
         // Initialization constructor
-        Vec(std::initializer_list<T> values) : Size(Size), values(values) {}
+        Vec(std::initializer_list<T> values) : values() {
+            CheckSize(values);
+            std::copy_n(values.begin(), Size, this->values.begin());
+        }
+
+        // Array constructor
+        constexpr explicit Vec(const std::array<T, Size>& values) : values(values) {}
 
         // Copy constructor
         Vec(const Vec<T, Size>& other) = default;
@@ -42,7 +53,7 @@ namespace Math {
 
         // Const Add by vector
         Vec<T, Size> Add(const Vec<T, Size>& other) const {
-            std::vector<T> result(this->values);
+            std::array<T, Size> result(this->values);
             for (uint32_t index = 0; index < Size; index++) {
                 result[index] += other[index];
             }
@@ -50,17 +61,18 @@ namespace Math {
         }
 
         // Const Add by values
-        Vec<T, Size> Add(T values...) const {
-            std::vector<T> result(this->values);
+        Vec<T, Size> Add(std::initializer_list<T> values) const {
+            CheckSize(values);
+            std::array<T, Size> result(this->values);
             for (uint32_t index = 0; index < Size; index++) {
-                result[index] += values[index];
+                result[index] += values.begin()[index];
             }
             return Vec<T, Size>(result);
         }
 
         // Const Scale by vector
         Vec<T, Size> Scale(const Vec<T, Size>& other) const {
-            std::vector<T> result(this->values);
+            std::array<T, Size> result(this->values);
             for (uint32_t index = 0; index < Size; index++) {
                 result[index] *= other[index];
             }
@@ -68,17 +80,18 @@ namespace Math {
         }
 
         // Const Scale by values
-        Vec<T, Size> Scale(T values...) const {
-            std::vector<T> result(this->values);
+        Vec<T, Size> Scale(std::initializer_list<T> values) const {
+            CheckSize(values);
+            std::array<T, Size> result(this->values);
             for (uint32_t index = 0; index < Size; index++) {
-                result[index] *= values[index];
+                result[index] *= values.begin()[index];
             }
             return Vec<T, Size>(result);
         }
 
         // Const Scale by one value
         Vec<T, Size> Scale(T scalar) const {
-            std::vector<T> result(this->values);
+            std::array<T, Size> result(this->values);
             for (uint32_t index = 0; index < Size; index++) {
                 result[index] *= scalar;
             }
@@ -91,11 +104,11 @@ namespace Math {
             for (T value : values) {
                 magnitude += value * value;
             }
-            magnitude = sqrt(magnitude);
+            magnitude = Sqrt(magnitude);
             if (magnitude == T(0)) {
                 throw VectorException(VectorError::NORMALIZE_ZERO);
             }
-            std::vector<T> result(this->values);
+            std::array<T, Size> result(this->values);
             for (uint32_t index = 0; index < Size; index++) {
                 result[index] /= magnitude;
             }
@@ -112,9 +125,10 @@ namespace Math {
         }
 
         // Mutator Add by values
-        Vec<T, Size> Add(T values...) {
+        Vec<T, Size> Add(std::initializer_list<T> values) {
+            CheckSize(values);
             for (uint32_t index = 0; index < Size; index++) {
-                this->values[index] += values[index];
+                this->values[index] += values.begin()[index];
             }
             return *this;
         }
@@ -128,9 +142,10 @@ namespace Math {
         }
 
         // Mutator Scale by values
-        Vec<T, Size> Scale(T values...) {
+        Vec<T, Size> Scale(std::initializer_list<T> values) {
+            CheckSize(values);
             for (uint32_t index = 0; index < Size; index++) {
-                this->values[index] *= values[index];
+                this->values[index] *= values.begin()[index];
             }
             return *this;
         }
@@ -149,7 +164,7 @@ namespace Math {
             for (T value : values) {
                 magnitude += value * value;
             }
-            magnitude = sqrt(magnitude);
+            magnitude = Sqrt(magnitude);
             if (magnitude == T(0)) {
                 throw VectorException(VectorError::NORMALIZE_ZERO);
             }
@@ -162,10 +177,21 @@ namespace Math {
 
         // Get normalized direction to another vector
         Vec<T, Size> DirectionTo(const Vec<T, Size>& other) const {
-            std::vector<T> result(this->values);
+            std::array<T, Size> result(this->values);
             for (uint32_t index = 0; index < Size; index++) {
                 result[index] = other[index] - values[index];
             }
+            T magnitude = T(0);
+            for (T value : result) {
+                magnitude += value * value;
+            }
+            magnitude = Sqrt(magnitude);
+            if (magnitude == T(0)) {
+                throw VectorException(VectorError::NORMALIZE_ZERO);
+            }
+            for (T& value : result) {
+                value /= magnitude;
+            }
             return Vec<T, Size>(result);
         }
 
@@ -175,7 +201,7 @@ namespace Math {
             for (T value : values) {
                 magnitude += value * value;
             }
-            return sqrt(magnitude);
+            return Sqrt(magnitude);
         }
 
         // Get the euclidean distance to another vector
@@ -185,7 +211,7 @@ namespace Math {
                 T difference = other[index] - values[index];
                 distSqr += difference * difference;
             }
-            return sqrt(distSqr);
+            return Sqrt(distSqr);
         }
 
         // Get the euclidean distance squared to another vector
@@ -198,9 +224,53 @@ namespace Math {
             return distSqr;
         }
 
+        // Get the dot product with another vector
+        T Dot(const Vec<T, Size>& other) const {
+            T dot = T(0);
+            for (uint32_t index = 0; index < Size; index++) {
+                dot += values[index] * other[index];
+            }
+            return dot;
+        }
+
+        // Get the unsigned angle in radians to another vector, 0 if either is
+        // zero. Uses 2 atan2(|u - v|, |u + v|) on the unit vectors u and v,
+        // which stays accurate near 0 and pi where acos of the cosine does not.
+        T AngleTo(const Vec<T, Size>& other) const {
+            using std::atan2;
+            T length = Magnitude();
+            T otherLength = other.Magnitude();
+            if (length == T(0) || otherLength == T(0)) {
+                return T(0);
+            }
+            T differenceSqr = T(0);
+            T sumSqr = T(0);
+            for (uint32_t index = 0; index < Size; index++) {
+                T u = values[index] / length;
+                T v = other[index] / otherLength;
+                differenceSqr += (u - v) * (u - v);
+                sumSqr += (u + v) * (u + v);
+            }
+            return T(2) * atan2(Sqrt(differenceSqr), Sqrt(sumSqr));
+        }
+
+        // Get the projection of this vector onto another vector
+        Vec<T, Size> ProjectOnto(const Vec<T, Size>& other) const {
+            T lengthSqr = other.Dot(other);
+            if (lengthSqr == T(0)) {
+                throw VectorException(VectorError::PROJECT_ZERO);
+            }
+            T factor = Dot(other) / lengthSqr;
+            std::array<T, Size> result(other.values);
+            for (T& value : result) {
+                value *= factor;
+            }
+            return Vec<T, Size>(result);
+        }
+
         // Overload stream insertion for pretty printing
         inline friend std::ostream& operator<<(
-            std::ostream& stream, const Vec<T>& vec) {
+            std::ostream& stream, const Vec<T, Size>& vec) {
             stream << "(";
             for (uint32_t index = 0; index < Size - 1; index++) {
                 stream << vec.values[index] << ", ";
@@ -214,6 +284,13 @@ namespace Math {
 
     private:
 
+        // Throw unless there is exactly one value per component
+        static void CheckSize(std::initializer_list<T> values) {
+            if (values.size() != Size) {
+                throw VectorException(VectorError::SIZE_MISMATCH);
+            }
+        }
+
         std::array<T, Size> values;
 
     };
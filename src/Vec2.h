@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Exception/VectorException.h"
+#include "Scalar.h"
 
 #include <cmath>
 #include <ostream>
@@ -18,51 +19,51 @@ namespace Math {
         Vec2() = delete;
 
         // Default constructor
-        Vec2(T x, T y) : x(x), y(y) {}
+        constexpr Vec2(T x, T y) : x(x), y(y) {}
 
         // Copy constructor
-        Vec2(const Vec2<T>& other) = default;
+        constexpr Vec2(const Vec2<T>& other) = default;
 
         // Move contstructor
-        Vec2(Vec2&& other) = default;
+        constexpr Vec2(Vec2&& other) = default;
 
         // Destructor
         ~Vec2() = default;
 
         // Copy assignment
-        Vec2& operator=(const Vec2& other) = default;
+        constexpr Vec2& operator=(const Vec2& other) = default;
 
         // Move assignment
-        Vec2& operator=(Vec2&& other) = default;
+        constexpr Vec2& operator=(Vec2&& other) = default;
 
         // Const Add by vector
-        Vec2<T> Add(const Vec2<T>& other) const {
+        constexpr Vec2<T> Add(const Vec2<T>& other) const {
             return Vec2<T>(x + other.x, y + other.y);
         }
 
         // Const Add by values
-        Vec2<T> Add(T dx, T dy) const {
+        constexpr Vec2<T> Add(T dx, T dy) const {
             return Vec2<T>(x + dx, y + dy);
         }
 
         // Const Scale by vector
-        Vec2<T> Scale(const Vec2<T>& other) const {
+        constexpr Vec2<T> Scale(const Vec2<T>& other) const {
             return Vec2<T>(x * other.x, y * other.y);
         }
 
         // Const Scale by values
-        Vec2<T> Scale(T dx, T dy) const {
+        constexpr Vec2<T> Scale(T dx, T dy) const {
             return Vec2<T>(x * dx, y * dy);
         }
 
         // Const Scale by one value
-        Vec2<T> Scale(T scalar) const {
+        constexpr Vec2<T> Scale(T scalar) const {
             return Vec2<T>(x * scalar, y * scalar);
         }
 
         // Const Normalize
         Vec2<T> Normalize() const {
-            auto magnitude = sqrt(x * x + y * y);
+            auto magnitude = Sqrt(x * x + y * y);
             if (magnitude == T(0)) {
                 throw VectorException(VectorError::NORMALIZE_ZERO);
             }
@@ -71,35 +72,35 @@ namespace Math {
 
 
         // Mutator Add by vector
-        Vec2<T> Add(const Vec2<T>& other) {
+        constexpr Vec2<T> Add(const Vec2<T>& other) {
             x += other.x;
             y += other.y;
             return *this;
         }
 
         // Mutator Add by values
-        Vec2<T> Add(T dx, T dy) {
+        constexpr Vec2<T> Add(T dx, T dy) {
             x += dx;
             y += dy;
             return *this;
         }
 
         // Mutator Scale by vector
-        Vec2<T> Scale(const Vec2<T>& other) {
+        constexpr Vec2<T> Scale(const Vec2<T>& other) {
             x *= other.x;
             y *= other.y;
             return *this;
         }
 
         // Mutator Scale by values
-        Vec2<T> Scale(T dx, T dy) {
+        constexpr Vec2<T> Scale(T dx, T dy) {
             x *= dx;
             y *= dy;
             return *this;
         }
 
         // Mutator Scale by one value
-        Vec2<T> Scale(T scalar) {
+        constexpr Vec2<T> Scale(T scalar) {
             x *= scalar;
             y *= scalar;
             return *this;
@@ -107,7 +108,7 @@ namespace Math {
 
         // Mutator Normalize
         Vec2<T> Normalize() {
-            auto magnitude = sqrt(x * x + y * y);
+            auto magnitude = Sqrt(x * x + y * y);
             if (magnitude == T(0)) {
                 throw VectorException(VectorError::NORMALIZE_ZERO);
             }
@@ -121,7 +122,7 @@ namespace Math {
         Vec2<T> DirectionTo(const Vec2<T>& other) const {
             auto newX = other.x - x;
             auto newY = other.y - y;
-            auto magnitude = sqrt(newX * newX + newY * newY);
+            auto magnitude = Sqrt(newX * newX + newY * newY);
             if (magnitude == T(0)) {
                 throw VectorException(VectorError::NORMALIZE_ZERO);
             }
@@ -132,23 +133,50 @@ namespace Math {
 
         // Get the euclidean distance to the origin (0, 0)
         T Magnitude() const {
-            return sqrt(x * x + y * y);
+            return Sqrt(x * x + y * y);
         }
 
         // Get the euclidean distance to another vector
         T DistanceTo(const Vec2<T>& other) const {
             auto dx = other.x - x;
             auto dy = other.y - y;
-            return sqrt(dx * dx + dy * dy);
+            return Sqrt(dx * dx + dy * dy);
         }
 
         // Get the euclidean distance squared to another vector
-        T DistanceSqrTo(const Vec2<T>& other) const {
+        constexpr T DistanceSqrTo(const Vec2<T>& other) const {
             auto dx = other.x - x;
             auto dy = other.y - y;
             return dx * dx + dy * dy;
         }
 
+        // Get the dot product with another vector
+        constexpr T Dot(const Vec2<T>& other) const {
+            return x * other.x + y * other.y;
+        }
+
+        // Get the z component of the 3D cross product with another vector
+        constexpr T Cross(const Vec2<T>& other) const {
+            return x * other.y - y * other.x;
+        }
+
+        // Get the unsigned angle in radians to another vector
+        T AngleTo(const Vec2<T>& other) const {
+            using std::abs;
+            using std::atan2;
+            return atan2(abs(Cross(other)), Dot(other));
+        }
+
+        // Get the projection of this vector onto another vector
+        Vec2<T> ProjectOnto(const Vec2<T>& other) const {
+            auto lengthSqr = other.x * other.x + other.y * other.y;
+            if (lengthSqr == T(0)) {
+                throw VectorException(VectorError::PROJECT_ZERO);
+            }
+            auto factor = Dot(other) / lengthSqr;
+            return Vec2<T>(other.x * factor, other.y * factor);
+        }
+
         // Overload stream insertion for pretty printing
         inline friend std::ostream& operator<<(
             std::ostream& stream, const Vec2<T>& vec) {
@@ -157,9 +185,9 @@ namespace Math {
             return stream;
         }
 
-        inline T GetX() const { return x; }
+        constexpr T GetX() const { return x; }
 
-        inline T GetY() const { return y; }
+        constexpr T GetY() const { return y; }
 
     private:
 
@@ -168,6 +196,6 @@ namespace Math {
     };
 
     template<typename T>
-    const Vec2<T> Vec2<T>::Origin(0, 0);
+    constexpr Vec2<T> Vec2<T>::Origin(0, 0);
 
 }
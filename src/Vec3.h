@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Exception/VectorException.h"
+#include "Scalar.h"
 
 #include <cmath>
 #include <ostream>
@@ -18,51 +19,51 @@ namespace Math {
         Vec3() = delete;
 
         // Default constructor
-        Vec3(T x, T y, T z) : x(x), y(y), z(z) {}
+        constexpr Vec3(T x, T y, T z) : x(x), y(y), z(z) {}
 
         // Copy constructor
-        Vec3(const Vec3<T>& other) = default;
+        constexpr Vec3(const Vec3<T>& other) = default;
 
         // Move contstructor
-        Vec3(Vec3&& other) = default;
+        constexpr Vec3(Vec3&& other) = default;
 
         // Destructor
         ~Vec3() = default;
 
         // Copy assignment
-        Vec3& operator=(const Vec3& other) = default;
+        constexpr Vec3& operator=(const Vec3& other) = default;
 
         // Move assignment
-        Vec3& operator=(Vec3&& other) = default;
+        constexpr Vec3& operator=(Vec3&& other) = default;
 
         // Const Add by vector
-        Vec3<T> Add(const Vec3<T>& other) const {
+        constexpr Vec3<T> Add(const Vec3<T>& other) const {
             return Vec3<T>(x + other.x, y + other.y, z + other.z);
         }
 
         // Const Add by values
-        Vec3<T> Add(T dx, T dy, T dz) const {
+        constexpr Vec3<T> Add(T dx, T dy, T dz) const {
             return Vec3<T>(x + dx, y + dy, z + dz);
         }
 
         // Const Scale by vector
-        Vec3<T> Scale(const Vec3<T>& other) const {
+        constexpr Vec3<T> Scale(const Vec3<T>& other) const {
             return Vec3<T>(x * other.x, y * other.y, z * other.z);
         }
 
         // Const Scale by values
-        Vec3<T> Scale(T dx, T dy, T dz) const {
+        constexpr Vec3<T> Scale(T dx, T dy, T dz) const {
             return Vec3<T>(x * dx, y * dy, z * dz);
         }
 
         // Const Scale by one value
-        Vec3<T> Scale(T scalar) const {
+        constexpr Vec3<T> Scale(T scalar) const {
             return Vec3<T>(x * scalar, y * scalar, z * scalar);
         }
 
         // Const Normalize
         Vec3<T> Normalize() const {
-            auto magnitude = sqrt(x * x + y * y + z * z);
+            auto magnitude = Sqrt(x * x + y * y + z * z);
             if (magnitude == T(0)) {
                 throw VectorException(VectorError::NORMALIZE_ZERO);
             }
@@ -71,7 +72,7 @@ namespace Math {
 
 
         // Mutator Add by vector
-        Vec3<T> Add(const Vec3<T>& other) {
+        constexpr Vec3<T> Add(const Vec3<T>& other) {
             x += other.x;
             y += other.y;
             z += other.z;
@@ -79,7 +80,7 @@ namespace Math {
         }
 
         // Mutator Add by values
-        Vec3<T> Add(T dx, T dy, T dz) {
+        constexpr Vec3<T> Add(T dx, T dy, T dz) {
             x += dx;
             y += dy;
             z += dz;
@@ -87,7 +88,7 @@ namespace Math {
         }
 
         // Mutator Scale by vector
-        Vec3<T> Scale(const Vec3<T>& other) {
+        constexpr Vec3<T> Scale(const Vec3<T>& other) {
             x *= other.x;
             y *= other.y;
             z *= other.z;
@@ -95,7 +96,7 @@ namespace Math {
         }
 
         // Mutator Scale by values
-        Vec3<T> Scale(T dx, T dy, T dz) {
+        constexpr Vec3<T> Scale(T dx, T dy, T dz) {
             x *= dx;
             y *= dy;
             z *= dz;
@@ -103,7 +104,7 @@ namespace Math {
         }
 
         // Mutator Scale by one value
-        Vec3<T> Scale(T scalar) {
+        constexpr Vec3<T> Scale(T scalar) {
             x *= scalar;
             y *= scalar;
             z *= scalar;
@@ -112,7 +113,7 @@ namespace Math {
 
         // Mutator Normalize
         Vec3<T> Normalize() {
-            auto magnitude = sqrt(x * x + y * y + z * z);
+            auto magnitude = Sqrt(x * x + y * y + z * z);
             if (magnitude == T(0)) {
                 throw VectorException(VectorError::NORMALIZE_ZERO);
             }
@@ -128,7 +129,7 @@ namespace Math {
             auto newX = other.x - x;
             auto newY = other.y - y;
             auto newZ = other.z - z;
-            auto magnitude = sqrt(newX * newX + newY * newY + newZ * newZ);
+            auto magnitude = Sqrt(newX * newX + newY * newY + newZ * newZ);
             if (magnitude == T(0)) {
                 throw VectorException(VectorError::NORMALIZE_ZERO);
             }
@@ -140,7 +141,7 @@ namespace Math {
 
         // Get the euclidean distance to the origin (0, 0, 0)
         T Magnitude() const {
-            return sqrt(x * x + y * y + z * z);
+            return Sqrt(x * x + y * y + z * z);
         }
 
         // Get the euclidean distance to another vector
@@ -148,17 +149,46 @@ namespace Math {
             auto dx = other.x - x;
             auto dy = other.y - y;
             auto dz = other.z - z;
-            return sqrt(dx * dx + dy * dy + dz * dz);
+            return Sqrt(dx * dx + dy * dy + dz * dz);
         }
 
         // Get the euclidean distance squared to another vector
-        T DistanceSqrTo(const Vec3<T>& other) const {
+        constexpr T DistanceSqrTo(const Vec3<T>& other) const {
             auto dx = other.x - x;
             auto dy = other.y - y;
             auto dz = other.z - z;
             return dx * dx + dy * dy + dz * dz;
         }
 
+        // Get the dot product with another vector
+        constexpr T Dot(const Vec3<T>& other) const {
+            return x * other.x + y * other.y + z * other.z;
+        }
+
+        // Get the cross product with another vector
+        constexpr Vec3<T> Cross(const Vec3<T>& other) const {
+            return Vec3<T>(
+                y * other.z - z * other.y,
+                z * other.x - x * other.z,
+                x * other.y - y * other.x);
+        }
+
+        // Get the unsigned angle in radians to another vector
+        T AngleTo(const Vec3<T>& other) const {
+            using std::atan2;
+            return atan2(Cross(other).Magnitude(), Dot(other));
+        }
+
+        // Get the projection of this vector onto another vector
+        Vec3<T> ProjectOnto(const Vec3<T>& other) const {
+            auto lengthSqr = other.x * other.x + other.y * other.y + other.z * other.z;
+            if (lengthSqr == T(0)) {
+                throw VectorException(VectorError::PROJECT_ZERO);
+            }
+            auto factor = Dot(other) / lengthSqr;
+            return Vec3<T>(other.x * factor, other.y * factor, other.z * factor);
+        }
+
         // Overload stream insertion for pretty printing
         inline friend std::ostream& operator<<(
             std::ostream& stream, const Vec3<T>& vec) {
@@ -168,11 +198,11 @@ namespace Math {
             return stream;
         }
 
-        inline T GetX() const { return x; }
+        constexpr T GetX() const { return x; }
 
-        inline T GetY() const { return y; }
+        constexpr T GetY() const { return y; }
 
-        inline T GetZ() const { return z; }
+        constexpr T GetZ() const { return z; }
 
     private:
 
@@ -181,6 +211,6 @@ namespace Math {
     };
 
     template<typename T>
-    const Vec3<T> Vec3<T>::Origin(0, 0, 0);
+    constexpr Vec3<T> Vec3<T>::Origin(0, 0, 0);
 
 }
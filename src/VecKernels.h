@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Config.h"
+#include "Vec2.h"
+#include "Vec3.h"
+
+#include <cstddef>
+
+namespace Math {
+
+    // Batched Dot and Cross over arrays of Vec2 and Vec3. Each loop body is
+    // independent, so the compiler vectorizes them across elements. Arrays of
+    // Vec3 interleave their components, which leaves the compiler to shuffle
+    // them into vector lanes; the overloads over separate x, y and z arrays
+    // (SoA) load and store whole vectors directly and run several times faster.
+    namespace VecKernels {
+
+        // out[i] = first[i] . second[i]
+        template<typename T>
+        void Dot(const Vec2<T>* first, const Vec2<T>* second, T* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = first[index].Dot(second[index]);
+            }
+        }
+
+        // out[i] = first[i] . second[i]
+        template<typename T>
+        void Dot(const Vec3<T>* first, const Vec3<T>* second, T* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = first[index].Dot(second[index]);
+            }
+        }
+
+        // out[i] = vec . many[i]
+        template<typename T>
+        void Dot(const Vec2<T>& vec, const Vec2<T>* many, T* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = vec.Dot(many[index]);
+            }
+        }
+
+        // out[i] = vec . many[i]
+        template<typename T>
+        void Dot(const Vec3<T>& vec, const Vec3<T>* many, T* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = vec.Dot(many[index]);
+            }
+        }
+
+        // out[i] = first[i] x second[i], the z component of the 3D cross product
+        template<typename T>
+        void Cross(const Vec2<T>* first, const Vec2<T>* second, T* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = first[index].Cross(second[index]);
+            }
+        }
+
+        // out[i] = first[i] x second[i]
+        template<typename T>
+        void Cross(const Vec3<T>* first, const Vec3<T>* second, Vec3<T>* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = first[index].Cross(second[index]);
+            }
+        }
+
+        // out[i] = vec x many[i]
+        template<typename T>
+        void Cross(const Vec3<T>& vec, const Vec3<T>* many, Vec3<T>* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = vec.Cross(many[index]);
+            }
+        }
+
+        // out[i] = a[i] . b[i] over SoA vectors, same result as Vec3::Dot
+        template<typename T>
+        void Dot(const T* ax, const T* ay, const T* az,
+            const T* bx, const T* by, const T* bz,
+            T* out, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                out[index] = ax[index] * bx[index] + ay[index] * by[index] + az[index] * bz[index];
+            }
+        }
+
+        // out[i] = a[i] x b[i] over SoA vectors, same result as Vec3::Cross.
+        // The outputs must not overlap the inputs or each other.
+        template<typename T>
+        void Cross(const T* ax, const T* ay, const T* az,
+            const T* bx, const T* by, const T* bz,
+            T* MATHUTIL_RESTRICT outX, T* MATHUTIL_RESTRICT outY, T* MATHUTIL_RESTRICT outZ, size_t count) {
+            for (size_t index = 0; index < count; index++) {
+                T x = ay[index] * bz[index] - az[index] * by[index];
+                T y = az[index] * bx[index] - ax[index] * bz[index];
+                T z = ax[index] * by[index] - ay[index] * bx[index];
+                outX[index] = x;
+                outY[index] = y;
+                outZ[index] = z;
+            }
+        }
+
+    }
+
+}
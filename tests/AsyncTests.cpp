@@ -0,0 +1,262 @@
+#include "Test.h"
+
+#include "Async/Async.h"
+#include "Mat3.h"
+#include "Reduce.h"
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Cancellation, progress and errors of the asynchronous operations, the
+// block-tree result of Async::Sum on any pool, and ThreadPool::Wait inside
+// and outside the pool
+
+using namespace Math;
+
+namespace {
+
+    // Occupies the only worker of a pool until Open is called, so the tasks
+    // queued behind it wait while the test inspects or cancels them
+    class Gate {
+
+    public:
+
+        explicit Gate(ThreadPool& pool) {
+            auto started = std::make_shared<std::promise<void>>();
+            std::future<void> running = started->get_future();
+            pool.Submit([started, opened = gate.get_future().share()] {
+                started->set_value();
+                opened.wait();
+            });
+            running.wait();
+        }
+
+        void Open() { gate.set_value(); }
+
+    private:
+
+        std::promise<void> gate;
+
+    };
+
+    // Whether reading the future throws AsyncException for cancellation
+    bool ThrowsCancelled(std::future<void>& future) {
+        try {
+            future.get();
+        }
+        catch (const AsyncException& exception) {
+            return std::string(exception.what()) == "Operation was cancelled";
+        }
+        return false;
+    }
+
+}
+
+TEST("Async operations stop on cancellation") {
+    ThreadPool pool(1);
+    std::atomic<size_t> chunks{ 0 };
+    Async::Options options;
+    options.pool = &pool;
+    options.grain = 10;
+
+    // Cancelled before any chunk starts, no chunk runs
+    Gate gate(pool);
+    std::future<void> future = Async::ParallelFor(100, [&](size_t, size_t) { chunks++; }, options);
+    options.token.Cancel();
+    gate.Open();
+    CHECK(ThrowsCancelled(future));
+    CHECK(chunks == 0);
+
+    // Cancelled by the third chunk, the chunks queued after it are skipped
+    Async::Options later;
+    later.pool = &pool;
+    later.grain = 10;
+    chunks = 0;
+    future = Async::ParallelFor(100, [&](size_t, size_t) {
+        if (++chunks == 3) {
+            later.token.Cancel();
+        }
+    }, later);
+    CHECK(ThrowsCancelled(future));
+    CHECK(chunks == 3);
+    CHECK(later.progress.Completed() == 30);
+
+    // A token cancelled after the work finished has no effect
+    Async::Options finished;
+    finished.pool = &pool;
+    future = Async::ParallelFor(100, [](size_t, size_t) {}, finished);
+    future.get();
+    finished.token.Cancel();
+    CHECK(finished.token.IsCancelled());
+}
+
+TEST("Async Progress counts finished items") {
+    ThreadPool pool(1);
+    Async::Options options;
+    options.pool = &pool;
+    options.grain = 64;
+    CHECK(options.progress.Total() == 0);
+    CHECK(options.progress.Fraction() == 0);
+
+    Gate gate(pool);
+    std::vector<size_t> seen;
+    const Progress progress = options.progress;
+    std::future<void> future = Async::ParallelFor(1000, [&](size_t, size_t) {
+        seen.push_back(progress.Completed());
+    }, options);
+    // Started on the calling thread, nothing finished behind the gate
+    CHECK(progress.Total() == 1000);
+    CHECK(progress.Completed() == 0);
+    gate.Open();
+    future.get();
+    CHECK(progress.Completed() == 1000);
+    CHECK(progress.Fraction() == 1);
+
+    // One worker runs the 16 chunks one at a time, so each sees the items
+    // of the chunks before it
+    bool growing = seen.size() == 16;
+    for (size_t index = 1; index < seen.size(); index++) {
+        growing = growing && seen[index] > seen[index - 1];
+    }
+    CHECK(growing);
+
+    // A second operation with the same Progress starts over
+    future = Async::ParallelFor(10, [](size_t, size_t) {}, options);
+    future.get();
+    CHECK(progress.Total() == 10);
+    CHECK(progress.Completed() == 10);
+}
+
+TEST("Async errors surface when the future is read") {
+    ThreadPool pool(2);
+    Async::Options options;
+    options.pool = &pool;
+    options.grain = 8;
+    std::atomic<size_t> chunks{ 0 };
+    std::future<void> future = Async::ParallelFor(800, [&](size_t begin, size_t) {
+        chunks++;
+        if (begin == 80) {
+            throw std::runtime_error("chunk failed");
+        }
+    }, options);
+    bool thrown = false;
+    try {
+        future.get();
+    }
+    catch (const std::runtime_error& exception) {
+        thrown = std::string(exception.what()) == "chunk failed";
+    }
+    CHECK(thrown);
+    CHECK(chunks <= 100);
+
+    // Singular matrices rethrow the MatrixException of Mat3::Inverse
+    std::vector<Mat3<double>> in(100, Mat3<double>(2, 0, 0, 0, 2, 0, 0, 0, 2));
+    std::vector<Mat3<double>> out(100, Mat3<double>(0, 0, 0, 0, 0, 0, 0, 0, 0));
+    in[57] = Mat3<double>(1, 2, 3, 2, 4, 6, 0, 0, 1);
+    future = Async::Inverse(in.data(), out.data(), in.size(), options);
+    thrown = false;
+    try {
+        future.get();
+    }
+    catch (const MatrixException& exception) {
+        thrown = std::string(exception.what()) == "Matrix is not invertible";
+    }
+    CHECK(thrown);
+
+    // Errors thrown while finishing take the same path
+    std::future<int> finish = Async::Detail::Run<int>(10, 5, options, [](size_t, size_t) {},
+        []() -> int { throw std::logic_error("finish failed"); });
+    thrown = false;
+    try {
+        finish.get();
+    }
+    catch (const std::logic_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+TEST("Async::Sum is the block tree sum on any pool") {
+    Test::Random random(1701);
+    std::vector<float> values(100003);
+    for (float& value : values) {
+        value = float(random.Spread(1000, 20));
+    }
+
+    // BlockSum of every block combined by TreeSum, computed serially
+    const size_t blocks = (values.size() + ReductionBlockSize - 1) / ReductionBlockSize;
+    std::vector<float> partials(blocks);
+    for (size_t block = 0; block < blocks; block++) {
+        size_t begin = block * ReductionBlockSize;
+        partials[block] = Reduce::BlockSum(values.data() + begin, std::min(ReductionBlockSize, values.size() - begin));
+    }
+    const float expected = Reduce::TreeSum(partials.data(), blocks);
+
+    bool same = true;
+    for (size_t threads : { 1, 2, 3 }) {
+        ThreadPool pool(threads);
+        for (size_t grain : { 1, 256, 1000, 4096, 1 << 20 }) {
+            Async::Options options;
+            options.pool = &pool;
+            options.grain = grain;
+            same = same && Async::Sum(values.data(), values.size(), options).get() == expected;
+        }
+    }
+    CHECK(same);
+#ifdef MATHUTIL_DETERMINISTIC
+    CHECK(expected == Reduce::Sum(values.data(), values.size()));
+#endif
+
+    Async::Options options;
+    ThreadPool pool(2);
+    options.pool = &pool;
+    CHECK(Async::Sum(values.data(), 0, options).get() == 0);
+    CHECK(Async::Sum(values.data(), 1, options).get() == values[0]);
+    CHECK(options.progress.Completed() == 1);
+}
+
+TEST("ThreadPool::Wait helps only on its own workers") {
+    // A task waiting on work queued behind it finishes on a one thread
+    // pool, since the waiting worker runs that work itself
+    ThreadPool pool(1);
+    Async::Options options;
+    options.pool = &pool;
+    options.grain = 1;
+    std::atomic<size_t> inner{ 0 };
+    std::future<void> outer = Async::ParallelFor(3, [&](size_t, size_t) {
+        std::future<void> nested = Async::ParallelFor(4, [&](size_t, size_t) { inner++; }, options);
+        pool.Wait(nested);
+    }, options);
+    pool.Wait(outer);
+    CHECK(inner == 12);
+
+    // Other threads block instead of running queued tasks
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<size_t> onCaller{ 0 };
+    Gate gate(pool);
+    std::future<void> queued = Async::ParallelFor(50, [&](size_t, size_t) {
+        onCaller += std::this_thread::get_id() == caller;
+    }, options);
+    std::thread opener([&gate] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        gate.Open();
+    });
+    pool.Wait(queued);
+    opener.join();
+    CHECK(onCaller == 0);
+
+    // A worker of another pool blocks too, and still gets the result
+    ThreadPool other(1);
+    std::promise<int> answer;
+    std::future<int> result = answer.get_future();
+    other.Submit([&] { answer.set_value(42); });
+    std::promise<int> relayed;
+    std::future<int> relay = relayed.get_future();
+    pool.Submit([&] { relayed.set_value(other.Wait(result)); });
+    CHECK(relay.get() == 42);
+}
@@ -0,0 +1,87 @@
+#include "Test.h"
+
+#include "Autodiff/Dual.h"
+#include "Autodiff/Tape.h"
+#include "Mat.h"
+#include "Mat3.h"
+#include "Vec3.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+// Forward and reverse mode gradients against central differences of the
+// same function evaluated in long double
+
+using namespace Math;
+
+namespace {
+
+    constexpr size_t Inputs = 28;
+
+    // Energy of a diagonally dominant Mat3, a Vec3 and a diagonally dominant
+    // Mat<4, 4>, through DistanceTo, Determinant, Inverse, atan2 and exp
+    template<typename S>
+    S Energy(const S* p) {
+        using std::atan2;
+        using std::exp;
+        const Mat3<S> matrix(p[0] + S(3), p[1], p[2], p[3], p[4] + S(3), p[5], p[6], p[7], p[8] + S(3));
+        const Vec3<S> point(p[9], p[10], p[11]);
+        const Mat<S, 4, 4> wide(
+            p[12] + S(4), p[13], p[14], p[15],
+            p[16], p[17] + S(4), p[18], p[19],
+            p[20], p[21], p[22] + S(4), p[23],
+            p[24], p[25], p[26], p[27] + S(4));
+        const Vec3<S> mapped = matrix.Inverse().Multiply(point);
+        const Mat<S, 4, 4> inverse = wide.Inverse();
+        return mapped.DistanceTo(point) + matrix.Determinant() + wide.Determinant() * S(0.1)
+            + inverse.Get(0, 3) + inverse.Get(2, 1) + atan2(p[9], p[10] + S(1)) * exp(p[11] * S(0.5));
+    }
+
+}
+
+TEST("Dual and Tape gradients match central differences") {
+    Test::Random random(1401);
+    Tape<double> tape;
+    double dualError = 0, tapeError = 0, agreement = 0;
+    for (size_t sample = 0; sample < 50; sample++) {
+        std::array<double, Inputs> point;
+        for (double& value : point) {
+            value = random.Uniform(-0.5, 0.5);
+        }
+        std::array<double, Inputs> dual, reverse;
+        double dualValue = Dual<double, Inputs>::Gradient([](const std::array<Dual<double, Inputs>, Inputs>& inputs) {
+            return Energy(inputs.data());
+        }, point, dual);
+        double tapeValue = tape.Gradient([](const Var<double>* inputs) { return Energy(inputs); },
+            point.data(), Inputs, reverse.data());
+        // Both divide by multiplying with the reciprocal, so the value can
+        // differ from plain double evaluation in the last bits
+        double value = Energy(point.data());
+        CHECK(std::fabs(dualValue - value) <= 1e-14 * std::max(1.0, std::fabs(value)));
+        CHECK(std::fabs(tapeValue - value) <= 1e-14 * std::max(1.0, std::fabs(value)));
+
+        // Truncation error of order h^2 and rounding of order epsilon / h
+        // stay far below the tolerance in long double
+        const long double step = 1e-6L;
+        std::array<long double, Inputs> shifted;
+        std::copy(point.begin(), point.end(), shifted.begin());
+        for (size_t index = 0; index < Inputs; index++) {
+            shifted[index] = point[index] + step;
+            long double above = Energy(shifted.data());
+            shifted[index] = point[index] - step;
+            long double below = Energy(shifted.data());
+            shifted[index] = point[index];
+            double expected = double((above - below) / (2 * step));
+            double scale = std::max(1.0, std::fabs(expected));
+            dualError = std::max(dualError, std::fabs(dual[index] - expected) / scale);
+            tapeError = std::max(tapeError, std::fabs(reverse[index] - expected) / scale);
+            agreement = std::max(agreement, std::fabs(dual[index] - reverse[index]) / scale);
+        }
+    }
+    std::cout << "    max relative error Dual " << dualError << ", Tape " << tapeError
+        << ", Dual against Tape " << agreement << "\n";
+    CHECK(dualError < 1e-8);
+    CHECK(tapeError < 1e-8);
+    CHECK(agreement < 1e-12);
+}
@@ -0,0 +1,439 @@
+#include "Test.h"
+
+#include "Autodiff/Tape.h"
+#include "CachedMat3.h"
+#include "FastMath.h"
+#include "FixedKernels.h"
+#include "Geometry/AABB3Batch.h"
+#include "Geometry/ConvexHull3.h"
+#include "Geometry/Delaunay2.h"
+#include "Geometry/Ray3.h"
+#include "Geometry/SweepAndPrune.h"
+#include "Random/Sample.h"
+#include "Reduce.h"
+#include "VecKernels.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Each benchmark times a fast path against the straightforward path it
+// replaces, on the same data, and reports the speedup against a budget set
+// well below the measured one.
+
+using namespace Math;
+
+namespace {
+
+    // Energy over groups of 12 inputs, each a diagonally dominant Mat3 and a
+    // Vec3, built from Inverse, Determinant and DistanceTo
+    template<typename S>
+    S Energy(const S* p, size_t count) {
+        S energy(0);
+        for (size_t k = 0; k < count; k += 12) {
+            const Mat3<S> matrix(p[k] + S(3), p[k + 1], p[k + 2], p[k + 3], p[k + 4] + S(3), p[k + 5],
+                p[k + 6], p[k + 7], p[k + 8] + S(3));
+            const Vec3<S> point(p[k + 9], p[k + 10], p[k + 11]);
+            const Vec3<S> mapped = matrix.Inverse().Multiply(point);
+            energy = energy + mapped.DistanceTo(point) + matrix.Determinant();
+        }
+        return energy;
+    }
+
+}
+
+BENCHMARK("AABB3Batch::Intersect against Ray3::Intersect") {
+    constexpr size_t Lanes = 16;
+    constexpr size_t Batches = 256;
+    Test::Random random(1001);
+    std::vector<AABB3<float>> boxes;
+    std::vector<AABB3Batch<float, Lanes>> batches(Batches);
+    for (size_t index = 0; index < Lanes * Batches; index++) {
+        const Vec3<float> center(float(random.Uniform(-10, 10)), float(random.Uniform(-10, 10)), float(random.Uniform(-10, 10)));
+        const Vec3<float> extent(float(random.Uniform(0, 1)), float(random.Uniform(0, 1)), float(random.Uniform(0, 1)));
+        boxes.emplace_back(center.Add(extent), center.Add(extent.Scale(-1.0f)));
+        batches[index / Lanes].Set(index % Lanes, boxes.back());
+    }
+    const Ray3<float> ray(Vec3<float>(-20, 0.1f, 0.2f), Vec3<float>(1, 0.05f, 0.02f));
+
+    double batched = 0;
+    double scalar = 0;
+    Test::MeasurePair(boxes.size(), [&] {
+        uint32_t hits = 0;
+        for (const auto& batch : batches) {
+            hits += batch.Intersect(ray).mask;
+        }
+        Test::Consume(hits);
+    }, [&] {
+        uint32_t hits = 0;
+        for (const auto& box : boxes) {
+            float distance;
+            hits += ray.Intersect(box, distance);
+        }
+        Test::Consume(hits);
+    }, batched, scalar);
+    CHECK_SPEEDUP("AABB3Batch::Intersect", batched, scalar, 1.5);
+}
+
+BENCHMARK("SoA VecKernels::Cross against Vec3::Cross") {
+    // 1K vectors keep the nine arrays in L1. From 4K on both loops are bound
+    // by memory bandwidth and the speedup drops to about 1.6x.
+    constexpr size_t Count = 1024;
+    Test::Random random(1002);
+    std::vector<Vec3<float>> a, b, out(Count, Vec3<float>(0, 0, 0));
+    std::vector<float> soa[6], soaOut[3];
+    for (size_t index = 0; index < Count; index++) {
+        a.emplace_back(float(random.Uniform(-1, 1)), float(random.Uniform(-1, 1)), float(random.Uniform(-1, 1)));
+        b.emplace_back(float(random.Uniform(-1, 1)), float(random.Uniform(-1, 1)), float(random.Uniform(-1, 1)));
+        soa[0].push_back(a.back().GetX());
+        soa[1].push_back(a.back().GetY());
+        soa[2].push_back(a.back().GetZ());
+        soa[3].push_back(b.back().GetX());
+        soa[4].push_back(b.back().GetY());
+        soa[5].push_back(b.back().GetZ());
+    }
+    for (std::vector<float>& component : soaOut) {
+        component.resize(Count);
+    }
+    double batched = 0;
+    double scalar = 0;
+    Test::MeasurePair(Count, [&] {
+        VecKernels::Cross(soa[0].data(), soa[1].data(), soa[2].data(), soa[3].data(), soa[4].data(),
+            soa[5].data(), soaOut[0].data(), soaOut[1].data(), soaOut[2].data(), Count);
+        Test::Consume(soaOut[0][Count / 2] + soaOut[1][Count / 2] + soaOut[2][Count / 2]);
+    }, [&] {
+        for (size_t index = 0; index < Count; index++) {
+            out[index] = a[index].Cross(b[index]);
+        }
+        Test::Consume(out[Count / 2]);
+    }, batched, scalar);
+    CHECK_SPEEDUP("SoA VecKernels::Cross", batched, scalar, 2);
+}
+
+BENCHMARK("FixedKernels against the same float loops") {
+    // Fixed is for determinism rather than speed, so the budgets only catch
+    // a kernel falling far behind the float loop it stands in for. Without
+    // AVX2 only Add is vectorized, and Scale is about 3x slower than float.
+    using F = Fixed<16, 16>;
+    using W = Fixed<32, 32>;
+    constexpr size_t Count = 4096;
+    Test::Random random(1008);
+    std::vector<F> a, b, out(Count);
+    std::vector<float> af, bf, outf(Count);
+    std::vector<Vec3<F>> a3, b3;
+    std::vector<Vec3<float>> a3f, b3f;
+    std::vector<W> aw, bw;
+    std::vector<double> ad, bd;
+    for (size_t index = 0; index < Count; index++) {
+        af.push_back(float(random.Uniform(-100, 100)));
+        bf.push_back(float(random.Uniform(-100, 100)));
+        a.emplace_back(double(af.back()));
+        b.emplace_back(double(bf.back()));
+        aw.emplace_back(double(af.back()));
+        bw.emplace_back(double(bf.back()));
+        ad.push_back(af.back());
+        bd.push_back(bf.back());
+        a3f.emplace_back(float(random.Uniform(-1, 1)), float(random.Uniform(-1, 1)), float(random.Uniform(-1, 1)));
+        b3f.emplace_back(float(random.Uniform(-1, 1)), float(random.Uniform(-1, 1)), float(random.Uniform(-1, 1)));
+        a3.emplace_back(F(double(a3f.back().GetX())), F(double(a3f.back().GetY())), F(double(a3f.back().GetZ())));
+        b3.emplace_back(F(double(b3f.back().GetX())), F(double(b3f.back().GetY())), F(double(b3f.back().GetZ())));
+    }
+    const F scalar(0.75);
+    double fixed = 0;
+    double floating = 0;
+    Test::MeasurePair(Count, [&] {
+        FixedKernels::Add(a.data(), b.data(), out.data(), Count);
+        Test::Consume(out[Count / 2]);
+    }, [&] {
+        for (size_t index = 0; index < Count; index++) {
+            outf[index] = af[index] + bf[index];
+        }
+        Test::Consume(outf[Count / 2]);
+    }, fixed, floating);
+    CHECK_SPEEDUP("FixedKernels::Add of Fixed<16, 16>", fixed, floating, 0.35);
+
+    Test::MeasurePair(Count, [&] {
+        FixedKernels::Scale(a.data(), scalar, out.data(), Count);
+        Test::Consume(out[Count / 2]);
+    }, [&] {
+        for (size_t index = 0; index < Count; index++) {
+            outf[index] = af[index] * 0.75f;
+        }
+        Test::Consume(outf[Count / 2]);
+    }, fixed, floating);
+    CHECK_SPEEDUP("FixedKernels::Scale of Fixed<16, 16>", fixed, floating, 0.15);
+
+    Test::MeasurePair(Count, [&] {
+        FixedKernels::Dot(a3.data(), b3.data(), out.data(), Count);
+        Test::Consume(out[Count / 2]);
+    }, [&] {
+        for (size_t index = 0; index < Count; index++) {
+            outf[index] = a3f[index].Dot(b3f[index]);
+        }
+        Test::Consume(outf[Count / 2]);
+    }, fixed, floating);
+    CHECK_SPEEDUP("FixedKernels::Dot of Vec3<Fixed<16, 16>>", fixed, floating, 0.4);
+
+    Test::MeasurePair(Count, [&] {
+        Test::Consume(FixedKernels::Dot(aw.data(), bw.data(), Count));
+    }, [&] {
+        double sum = 0;
+        for (size_t index = 0; index < Count; index++) {
+            sum += ad[index] * bd[index];
+        }
+        Test::Consume(sum);
+    }, fixed, floating);
+    CHECK_SPEEDUP("FixedKernels::Dot of Fixed<32, 32>", fixed, floating, 0.4);
+}
+
+BENCHMARK("Deterministic reduction against fast reduction") {
+    // The deterministic Reduce::Sum and Reduce::Dot are the block tree
+    // below, rebuilt from the public pieces so both run in one binary
+    constexpr size_t Count = size_t(1) << 14;
+    constexpr size_t Blocks = (Count + ReductionBlockSize - 1) / ReductionBlockSize;
+    Test::Random random(1003);
+    std::vector<float> a(Count), b(Count);
+    for (size_t index = 0; index < Count; index++) {
+        a[index] = float(random.Uniform(-1, 1));
+        b[index] = float(random.Uniform(-1, 1));
+    }
+    const float* first = a.data();
+    const float* second = b.data();
+    double deterministic = 0;
+    double fast = 0;
+    Test::MeasurePair(Count, [&] {
+        float sum = Reduce::Tree<float>(0, Blocks, [first](size_t block) {
+            size_t begin = block * ReductionBlockSize;
+            return Reduce::BlockSum(first + begin, std::min(ReductionBlockSize, Count - begin));
+        });
+        float dot = Reduce::Tree<float>(0, Blocks, [first, second](size_t block) {
+            size_t begin = block * ReductionBlockSize;
+            return Reduce::BlockDot(first + begin, second + begin, std::min(ReductionBlockSize, Count - begin));
+        });
+        Test::Consume(sum + dot);
+    }, [&] {
+        Test::Consume(Reduce::Sum(first, Count) + Reduce::Dot(first, second, Count));
+    }, deterministic, fast);
+    std::cout << "    per call of Sum and Dot over " << Count << " floats: " << deterministic * Count * 1e-6
+        << " ms deterministic, " << fast * Count * 1e-6 << " ms fast\n";
+    CHECK_SPEEDUP("Deterministic Sum and Dot", deterministic, fast, 0.7);
+}
+
+BENCHMARK("FastMath arrays against libm") {
+    constexpr size_t Count = 4096;
+    Test::Random random(1004);
+    std::vector<float> angles(Count), ys(Count), xs(Count), exponents(Count), out(Count), other(Count);
+    for (size_t index = 0; index < Count; index++) {
+        angles[index] = float(random.Uniform(-100, 100));
+        ys[index] = float(random.Uniform(-10, 10));
+        xs[index] = float(random.Uniform(-10, 10));
+        exponents[index] = float(random.Uniform(-80, 80));
+    }
+
+    double fast = 0;
+    double reference = 0;
+    Test::MeasurePair(Count, [&] {
+        FastMath::Sin(angles.data(), out.data(), Count);
+        Test::Consume(out[Count / 2]);
+    }, [&] {
+        for (size_t index = 0; index < Count; index++) {
+            out[index] = std::sin(angles[index]);
+        }
+        Test::Consume(out[Count / 2]);
+    }, fast, reference);
+    CHECK_SPEEDUP("FastMath::Sin", fast, reference, 1.8);
+
+    Test::MeasurePair(Count, [&] {
+        FastMath::SinCos(angles.data(), out.data(), other.data(), Count);
+        Test::Consume(out[Count / 2] + other[Count / 2]);
+    }, [&] {
+        for (size_t index = 0; index < Count; index++) {
+            out[index] = std::sin(angles[index]);
+            other[index] = std::cos(angles[index]);
+        }
+        Test::Consume(out[Count / 2] + other[Count / 2]);
+    }, fast, reference);
+    CHECK_SPEEDUP("FastMath::SinCos", fast, reference, 2.5);
+
+    Test::MeasurePair(Count, [&] {
+        FastMath::Atan2(ys.data(), xs.data(), out.data(), Count);
+        Test::Consume(out[Count / 2]);
+    }, [&] {
+        for (size_t index = 0; index < Count; index++) {
+            out[index] = std::atan2(ys[index], xs[index]);
+        }
+        Test::Consume(out[Count / 2]);
+    }, fast, reference);
+    CHECK_SPEEDUP("FastMath::Atan2", fast, reference, 5);
+
+    Test::MeasurePair(Count, [&] {
+        FastMath::Exp(exponents.data(), out.data(), Count);
+        Test::Consume(out[Count / 2]);
+    }, [&] {
+        for (size_t index = 0; index < Count; index++) {
+            out[index] = std::exp(exponents[index]);
+        }
+        Test::Consume(out[Count / 2]);
+    }, fast, reference);
+    CHECK_SPEEDUP("FastMath::Exp", fast, reference, 1.15);
+}
+
+BENCHMARK("CachedMat3::Inverse against Mat3::Inverse") {
+    constexpr size_t Count = 4000;
+    Test::Random random(1005);
+    std::vector<Mat3<float>> matrices;
+    std::vector<CachedMat3<float>> cached;
+    for (size_t index = 0; index < Count; index++) {
+        float values[9];
+        for (float& value : values) {
+            value = float(random.Uniform(-1, 1));
+        }
+        // Diagonally dominant, so every matrix is invertible
+        matrices.emplace_back(values[0] + 4, values[1], values[2], values[3], values[4] + 4, values[5],
+            values[6], values[7], values[8] + 4);
+        cached.emplace_back(matrices.back());
+    }
+    const Vec3<float> point(1, 2, 3);
+
+    // Every product of the inverse is summed so no element can be skipped
+    double fast = 0;
+    double reference = 0;
+    Test::MeasurePair(Count, [&] {
+        Vec3<float> sum(0, 0, 0);
+        for (const auto& matrix : cached) {
+            sum.Add(matrix.Inverse().Multiply(point));
+        }
+        Test::Consume(sum);
+    }, [&] {
+        Vec3<float> sum(0, 0, 0);
+        for (const auto& matrix : matrices) {
+            sum.Add(matrix.Inverse().Multiply(point));
+        }
+        Test::Consume(sum);
+    }, fast, reference);
+    CHECK_SPEEDUP("CachedMat3::Inverse", fast, reference, 1.8);
+}
+
+// The reference normalizes Gaussian triples, the textbook way to get directions
+// uniform on the sphere, so both sides produce the same distribution
+BENCHMARK("Sample::Sphere against normalized std::normal_distribution triples") {
+    constexpr size_t Count = 4096;
+    const Philox generator(1006);
+    std::mt19937 engine(1006);
+    std::normal_distribution<float> distribution(0.0f, 1.0f);
+    std::vector<Vec3<float>> out(Count, Vec3<float>(0, 0, 0));
+    uint64_t first = 0;
+    double fast = 0;
+    double reference = 0;
+    Test::MeasurePair(Count, [&] {
+        Sample::Sphere(generator, first, out.data(), Count);
+        first += Count;
+        Test::Consume(out[Count / 2]);
+    }, [&] {
+        for (size_t index = 0; index < Count; index++) {
+            const Vec3<float> triple(distribution(engine), distribution(engine), distribution(engine));
+            out[index] = triple.Normalize();
+        }
+        Test::Consume(out[Count / 2]);
+    }, fast, reference);
+    CHECK_SPEEDUP("Sample::Sphere", fast, reference, 2);
+}
+
+BENCHMARK("Tape::Gradient against central differences") {
+    constexpr size_t Count = 60;
+    std::vector<double> point(Count), gradient(Count), shifted(Count);
+    for (size_t index = 0; index < Count; index++) {
+        point[index] = 0.01 * double(index);
+    }
+    Tape<double> tape;
+    double fast = 0;
+    double reference = 0;
+    Test::MeasurePair(1, [&] {
+        double value = tape.Gradient([](const Var<double>* inputs) { return Energy(inputs, Count); },
+            point.data(), Count, gradient.data());
+        Test::Consume(value + gradient[Count / 2]);
+    }, [&] {
+        shifted = point;
+        for (size_t index = 0; index < Count; index++) {
+            shifted[index] = point[index] + 1e-6;
+            double above = Energy(shifted.data(), Count);
+            shifted[index] = point[index] - 1e-6;
+            double below = Energy(shifted.data(), Count);
+            shifted[index] = point[index];
+            gradient[index] = (above - below) / 2e-6;
+        }
+        Test::Consume(gradient[Count / 2]);
+    }, fast, reference);
+    CHECK_SPEEDUP("Tape::Gradient", fast, reference, 1.5);
+}
+
+BENCHMARK("SweepAndPrune frames of 1M moving boxes") {
+    constexpr size_t Count = 1000000;
+    Test::Random random(1502);
+    std::vector<AABB3<float>> boxes, moved;
+    for (size_t index = 0; index < Count; index++) {
+        const Vec3<float> corner(float(random.Uniform(0, 2000)), float(random.Uniform(0, 200)),
+            float(random.Uniform(0, 200)));
+        const Vec3<float> extent(float(random.Uniform(0, 0.4)), float(random.Uniform(0, 0.4)),
+            float(random.Uniform(0, 0.4)));
+        const Vec3<float> offset(float(random.Uniform(-0.002, 0.002)), float(random.Uniform(-0.002, 0.002)),
+            float(random.Uniform(-0.002, 0.002)));
+        boxes.emplace_back(corner, corner.Add(extent));
+        moved.emplace_back(corner.Add(offset), corner.Add(extent).Add(offset));
+    }
+    // The first frame radix sorts from scratch. Later frames alternate
+    // between two slightly moved copies of the boxes, so each one re-sorts
+    // last frame's order with the insertion sort.
+    SweepAndPrune<float> broadphase;
+    double cold = 1e-9 * Test::MeasureOnce(1, [&] {
+        broadphase = SweepAndPrune<float>();
+        broadphase.Update(boxes.data(), Count);
+        Test::Consume(broadphase.FindPairs().size());
+    });
+    bool flip = false;
+    double coherent = 1e-9 * Test::MeasureOnce(1, [&] {
+        flip = !flip;
+        broadphase.Update(flip ? moved.data() : boxes.data(), Count);
+        Test::Consume(broadphase.FindPairs().size());
+    });
+    std::cout << "    " << broadphase.FindPairs().size() << " pairs per frame\n";
+    CHECK_TIME("First SweepAndPrune frame of 1M boxes", cold, 0.55);
+    CHECK_TIME("Coherent SweepAndPrune frame of 1M boxes", coherent, 0.45);
+}
+
+BENCHMARK("Delaunay2 and ConvexHull3 at the sizes quoted in the README") {
+    // One run each, there is no reference path to pair them with
+    Test::Random random(1301);
+    std::vector<Vec2<double>> plane;
+    for (size_t index = 0; index < 1000000; index++) {
+        plane.emplace_back(random.Uniform(0, 1), random.Uniform(0, 1));
+    }
+    Delaunay2<double> delaunay;
+    double seconds = 1e-9 * Test::MeasureOnce(1, [&] {
+        Test::Consume(delaunay.Triangulate(plane.data(), plane.size()).size());
+    });
+    CHECK_TIME("Delaunay2 of 1M uniform points", seconds, 1.5);
+
+    std::vector<Vec3<double>> cube;
+    for (size_t index = 0; index < 2000000; index++) {
+        cube.emplace_back(random.Uniform(-1, 1), random.Uniform(-1, 1), random.Uniform(-1, 1));
+    }
+    ConvexHull3<double> hull;
+    seconds = 1e-9 * Test::MeasureOnce(1, [&] {
+        Test::Consume(hull.Build(cube.data(), cube.size()).size());
+    });
+    CHECK_TIME("ConvexHull3 of 2M points in a cube", seconds, 0.9);
+
+    std::vector<Vec3<double>> sphere;
+    while (sphere.size() < 1000000) {
+        const Vec3<double> point(random.Uniform(-1, 1), random.Uniform(-1, 1), random.Uniform(-1, 1));
+        double length = point.Magnitude();
+        if (length > 0.1 && length <= 1) {
+            sphere.push_back(point.Scale(1 / length));
+        }
+    }
+    seconds = 1e-9 * Test::MeasureOnce(1, [&] {
+        Test::Consume(hull.Build(sphere.data(), sphere.size()).size());
+    });
+    CHECK_TIME("ConvexHull3 of 1M points on a sphere", seconds, 3.2);
+}
@@ -0,0 +1,272 @@
+#include "Test.h"
+
+#include "Curve/CubicCurveArray3.h"
+#include "Curve/Interpolate.h"
+#include "Vec2.h"
+#include "Vec3.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Power form curves against direct Bezier, Catmull-Rom and B-spline
+// evaluation, forward differencing against Evaluate and the arc-length
+// tables against an integral of the speed
+
+using namespace Math;
+
+namespace {
+
+    using Point = Vec3<double>;
+
+    // Component-wise (first - second) * scale
+    Point Difference(const Point& first, const Point& second, double scale) {
+        return Point(
+            (first.GetX() - second.GetX()) * scale,
+            (first.GetY() - second.GetY()) * scale,
+            (first.GetZ() - second.GetZ()) * scale);
+    }
+
+    // De Casteljau's construction of a Bezier segment
+    Point Bezier(const Point* p, double t) {
+        const Point a = Interpolate::Lerp(p[0], p[1], t);
+        const Point b = Interpolate::Lerp(p[1], p[2], t);
+        const Point c = Interpolate::Lerp(p[2], p[3], t);
+        return Interpolate::Lerp(Interpolate::Lerp(a, b, t), Interpolate::Lerp(b, c, t), t);
+    }
+
+    // Barry and Goldman's pyramid for a uniform Catmull-Rom segment with
+    // knots -1, 0, 1, 2
+    Point CatmullRom(const Point* p, double t) {
+        const Point a1 = Interpolate::Lerp(p[0], p[1], t + 1);
+        const Point a2 = Interpolate::Lerp(p[1], p[2], t);
+        const Point a3 = Interpolate::Lerp(p[2], p[3], t - 1);
+        const Point b1 = Interpolate::Lerp(a1, a2, (t + 1) / 2);
+        const Point b2 = Interpolate::Lerp(a2, a3, t / 2);
+        return Interpolate::Lerp(b1, b2, t);
+    }
+
+    // De Boor's algorithm for a uniform cubic B-spline with knots 0 to 7,
+    // on the span from knot 3 to knot 4
+    Point BSpline(const Point* p, double t) {
+        std::vector<Point> d(p, p + 4);
+        for (int r = 1; r <= 3; r++) {
+            for (int j = 3; j >= r; j--) {
+                double alpha = (3 + t - j) / double(4 - r);
+                d[j] = Interpolate::Lerp(d[j - 1], d[j], alpha);
+            }
+        }
+        return d[3];
+    }
+
+    Point Direct(const Point* p, CubicBasis basis, double t) {
+        switch (basis) {
+        case CubicBasis::BEZIER:
+            return Bezier(p, t);
+        case CubicBasis::CATMULL_ROM:
+            return CatmullRom(p, t);
+        default:
+            return BSpline(p, t);
+        }
+    }
+
+    // Arc length of a curve from 0 to end by Simpson's rule on the speed
+    double ArcLength(const CubicCurveArray3<double>& curves, size_t curve, double end) {
+        constexpr size_t Intervals = 1 << 12;
+        double h = end / Intervals;
+        double sum = curves.Derivative(curve, 0).Magnitude() + curves.Derivative(curve, end).Magnitude();
+        for (size_t index = 1; index < Intervals; index++) {
+            sum += (index % 2 ? 4 : 2) * curves.Derivative(curve, h * double(index)).Magnitude();
+        }
+        return sum * h / 3;
+    }
+
+    // Random curves of every basis with control points in [-10, 10)
+    CubicCurveArray3<double> RandomCurves(Test::Random& random, std::vector<Point>& points, size_t count) {
+        CubicCurveArray3<double> curves;
+        for (size_t curve = 0; curve < count; curve++) {
+            for (size_t index = 0; index < 4; index++) {
+                points.emplace_back(random.Uniform(-10, 10), random.Uniform(-10, 10), random.Uniform(-10, 10));
+            }
+            const Point* p = &points[curve * 4];
+            CHECK(curves.Add(p[0], p[1], p[2], p[3], CubicBasis(curve % 3)) == curve);
+        }
+        return curves;
+    }
+
+}
+
+TEST("CubicCurveArray3 matches direct Bezier, Catmull-Rom and B-spline evaluation") {
+    Test::Random random(1501);
+    std::vector<Point> points;
+    const CubicCurveArray3<double> curves = RandomCurves(random, points, 300);
+    CHECK(curves.Size() == 300);
+
+    double pointError = 0, derivativeError = 0, ends = 0;
+    std::vector<double> t(17);
+    std::vector<Point> batch(17, Point(0, 0, 0));
+    for (size_t curve = 0; curve < curves.Size(); curve++) {
+        const Point* p = &points[curve * 4];
+        CubicBasis basis = CubicBasis(curve % 3);
+        for (size_t index = 0; index < t.size(); index++) {
+            t[index] = index == 0 ? 0.0 : index == 1 ? 1.0 : random.Uniform(0, 1);
+        }
+        curves.Evaluate(curve, t.data(), batch.data(), t.size());
+        for (size_t index = 0; index < t.size(); index++) {
+            pointError = std::max(pointError, curves.Evaluate(curve, t[index]).DistanceTo(Direct(p, basis, t[index])));
+            pointError = std::max(pointError, batch[index].DistanceTo(curves.Evaluate(curve, t[index])));
+            const double step = 1e-5;
+            const Point difference = Difference(Direct(p, basis, t[index] + step), Direct(p, basis, t[index] - step), 1 / (2 * step));
+            derivativeError = std::max(derivativeError, curves.Derivative(curve, t[index]).DistanceTo(difference));
+        }
+
+        // Bezier segments run from p0 to p3 and Catmull-Rom segments from p1
+        // to p2, with tangents 3 (p1 - p0) and (p2 - p0) / 2 at the start
+        if (basis == CubicBasis::BEZIER) {
+            ends = std::max(ends, curves.Evaluate(curve, 0).DistanceTo(p[0]) + curves.Evaluate(curve, 1).DistanceTo(p[3]));
+            ends = std::max(ends, curves.Derivative(curve, 0).DistanceTo(Difference(p[1], p[0], 3)));
+        }
+        else if (basis == CubicBasis::CATMULL_ROM) {
+            ends = std::max(ends, curves.Evaluate(curve, 0).DistanceTo(p[1]) + curves.Evaluate(curve, 1).DistanceTo(p[2]));
+            ends = std::max(ends, curves.Derivative(curve, 0).DistanceTo(Difference(p[2], p[0], 0.5)));
+        }
+    }
+    CHECK(pointError < 1e-12);
+    CHECK(derivativeError < 1e-7);
+    CHECK(ends < 1e-12);
+
+    std::vector<Point> all(curves.Size(), Point(0, 0, 0));
+    curves.EvaluateAll(0.375, all.data());
+    bool same = true;
+    for (size_t curve = 0; curve < curves.Size(); curve++) {
+        same = same && all[curve].DistanceTo(curves.Evaluate(curve, 0.375)) == 0;
+    }
+    CHECK(same);
+}
+
+TEST("CubicCurveArray3::SampleUniform forward differencing matches Evaluate") {
+    Test::Random random(1502);
+    std::vector<Point> points;
+    const CubicCurveArray3<double> curves = RandomCurves(random, points, 30);
+    CubicCurveArray3<float> single;
+    for (size_t curve = 0; curve < curves.Size(); curve++) {
+        const Point* p = &points[curve * 4];
+        single.Add(
+            Vec3<float>(float(p[0].GetX()), float(p[0].GetY()), float(p[0].GetZ())),
+            Vec3<float>(float(p[1].GetX()), float(p[1].GetY()), float(p[1].GetZ())),
+            Vec3<float>(float(p[2].GetX()), float(p[2].GetY()), float(p[2].GetZ())),
+            Vec3<float>(float(p[3].GetX()), float(p[3].GetY()), float(p[3].GetZ())),
+            CubicBasis(curve % 3));
+    }
+
+    // The differences carry rounding from step to step, so the error grows
+    // with the number of samples but stays small against the curve's size
+    double error = 0, singleError = 0;
+    for (size_t count : { size_t(2), size_t(3), size_t(10), size_t(1000) }) {
+        std::vector<Point> samples(count, Point(0, 0, 0));
+        std::vector<Vec3<float>> singleSamples(count, Vec3<float>(0, 0, 0));
+        for (size_t curve = 0; curve < curves.Size(); curve++) {
+            curves.SampleUniform(curve, count, samples.data());
+            single.SampleUniform(curve, count, singleSamples.data());
+            for (size_t index = 0; index < count; index++) {
+                double t = double(index) / double(count - 1);
+                error = std::max(error, samples[index].DistanceTo(curves.Evaluate(curve, t)));
+                const Point sample(singleSamples[index].GetX(), singleSamples[index].GetY(), singleSamples[index].GetZ());
+                singleError = std::max(singleError, sample.DistanceTo(curves.Evaluate(curve, t)));
+            }
+        }
+    }
+    CHECK(error < 1e-9);
+    CHECK(singleError < 1e-2);
+
+    Point one(1, 1, 1);
+    curves.SampleUniform(4, 1, &one);
+    CHECK(one.DistanceTo(curves.Evaluate(4, 0)) == 0);
+    curves.SampleUniform(4, 0, nullptr);
+}
+
+TEST("CubicCurveArray3 arc-length tables match the integral of the speed") {
+    Test::Random random(1503);
+    std::vector<Point> points;
+    const CubicCurveArray3<double> curves = RandomCurves(random, points, 60);
+
+    // 64 chords fall short of the length by the square of the chord angle,
+    // which stays well below a thousandth on these curves
+    double lengthError = 0, distanceError = 0, spacingError = 0;
+    std::vector<Point> samples(33, Point(0, 0, 0));
+    for (size_t curve = 0; curve < curves.Size(); curve++) {
+        double length = ArcLength(curves, curve, 1);
+        lengthError = std::max(lengthError, std::fabs(curves.Length(curve) - length) / length);
+        CHECK(curves.Length(curve) <= length);
+
+        for (size_t index = 0; index < 8; index++) {
+            double distance = random.Uniform(0, length);
+            double t = curves.ParameterAtDistance(curve, distance);
+            distanceError = std::max(distanceError, std::fabs(ArcLength(curves, curve, t) - distance) / length);
+        }
+        CHECK(curves.ParameterAtDistance(curve, -1) == 0);
+        CHECK(curves.ParameterAtDistance(curve, 2 * length) == 1);
+
+        // Constant speed samples split the length into equal arcs
+        curves.SampleConstantSpeed(curve, samples.size(), samples.data());
+        double previous = 0;
+        for (size_t index = 1; index < samples.size(); index++) {
+            double t = curves.ParameterAtDistance(curve, curves.Length(curve) * double(index) / double(samples.size() - 1));
+            double arc = ArcLength(curves, curve, t);
+            spacingError = std::max(spacingError, std::fabs(arc - previous - length / 32) / length);
+            CHECK(samples[index].DistanceTo(curves.Evaluate(curve, t)) == 0);
+            previous = arc;
+        }
+    }
+    CHECK(lengthError < 1e-3);
+    CHECK(distanceError < 1e-3);
+    CHECK(spacingError < 1e-3);
+
+    // A curve collapsed to a point has no length
+    CubicCurveArray3<double> point;
+    point.Add(Point(1, 2, 3), Point(1, 2, 3), Point(1, 2, 3), Point(1, 2, 3), CubicBasis::BEZIER);
+    CHECK(point.Length(0) == 0);
+    CHECK(point.ParameterAtDistance(0, 0.5) == 1);
+}
+
+TEST("Interpolate batches match single Lerp and Nlerp") {
+    Test::Random random(1504);
+    constexpr size_t Count = 101;
+    std::vector<Vec3<double>> from, to, out(Count, Vec3<double>(0, 0, 0)), perPair(Count, Vec3<double>(0, 0, 0));
+    std::vector<Vec2<double>> from2, to2, out2(Count, Vec2<double>(0, 0));
+    std::vector<double> t;
+    for (size_t index = 0; index < Count; index++) {
+        from.emplace_back(random.Uniform(-1, 1), random.Uniform(-1, 1), random.Uniform(-1, 1));
+        to.emplace_back(random.Uniform(-1, 1), random.Uniform(-1, 1), random.Uniform(-1, 1));
+        from2.emplace_back(random.Uniform(-1, 1), random.Uniform(-1, 1));
+        to2.emplace_back(random.Uniform(-1, 1), random.Uniform(-1, 1));
+        t.push_back(random.Uniform(0, 1));
+    }
+
+    bool same = true;
+    Interpolate::Lerp(from.data(), to.data(), 0.25, out.data(), Count);
+    Interpolate::Lerp(from.data(), to.data(), t.data(), perPair.data(), Count);
+    Interpolate::Lerp(from2.data(), to2.data(), t.data(), out2.data(), Count);
+    for (size_t index = 0; index < Count; index++) {
+        same = same && out[index].DistanceTo(Interpolate::Lerp(from[index], to[index], 0.25)) == 0;
+        same = same && perPair[index].DistanceTo(Interpolate::Lerp(from[index], to[index], t[index])) == 0;
+        same = same && out2[index].DistanceTo(Interpolate::Lerp(from2[index], to2[index], t[index])) == 0;
+    }
+    CHECK(same);
+
+    // Nlerp gives unit directions between the two inputs
+    double unit = 0;
+    Interpolate::Nlerp(from.data(), to.data(), 0.75, out.data(), Count);
+    Interpolate::Nlerp(from.data(), to.data(), t.data(), perPair.data(), Count);
+    Interpolate::Nlerp(from2.data(), to2.data(), t.data(), out2.data(), Count);
+    for (size_t index = 0; index < Count; index++) {
+        same = same && out[index].DistanceTo(Interpolate::Nlerp(from[index], to[index], 0.75)) == 0;
+        same = same && perPair[index].DistanceTo(Interpolate::Nlerp(from[index], to[index], t[index])) == 0;
+        same = same && out2[index].DistanceTo(Interpolate::Nlerp(from2[index], to2[index], t[index])) == 0;
+        unit = std::max(unit, std::fabs(perPair[index].Magnitude() - 1) + std::fabs(out2[index].Magnitude() - 1));
+    }
+    CHECK(same);
+    CHECK(unit < 1e-15);
+    CHECK(Interpolate::Lerp(from[0], to[0], 0.0).DistanceTo(from[0]) == 0);
+    CHECK(Interpolate::Lerp(from[0], to[0], 1.0).DistanceTo(to[0]) < 1e-15);
+}
@@ -0,0 +1,109 @@
+#include "Test.h"
+
+#include "Fixed.h"
+#include "FixedKernels.h"
+#include "Vec3.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Fixed is exact integer arithmetic, so the batched kernels must match the
+// scalar operators bit for bit, and the 64-bit operators must be within one
+// step of the exact result
+
+using namespace Math;
+
+namespace {
+
+    constexpr size_t Count = 1 << 14;
+
+    template<typename F>
+    std::vector<F> RandomFixed(Test::Random& random, size_t count, double range) {
+        std::vector<F> result;
+        result.reserve(count);
+        for (size_t index = 0; index < count; index++) {
+            result.emplace_back(random.Uniform(-range, range));
+        }
+        return result;
+    }
+
+    template<typename F>
+    void CheckKernels(uint64_t seed, double range) {
+        Test::Random random(seed);
+        const std::vector<F> a = RandomFixed<F>(random, 3 * Count, range);
+        const std::vector<F> b = RandomFixed<F>(random, 3 * Count, range);
+        std::vector<Vec3<F>> first, second;
+        for (size_t index = 0; index < Count; index++) {
+            first.emplace_back(a[3 * index], a[3 * index + 1], a[3 * index + 2]);
+            second.emplace_back(b[3 * index], b[3 * index + 1], b[3 * index + 2]);
+        }
+
+        std::vector<F> dots(Count), scaled(3 * Count);
+        FixedKernels::Dot(first.data(), second.data(), dots.data(), Count);
+        FixedKernels::Scale(a.data(), b[0], scaled.data(), 3 * Count);
+        F sum;
+        for (size_t index = 0; index < 3 * Count; index++) {
+            sum += a[index] * b[index];
+            CHECK(scaled[index] == a[index] * b[0]);
+        }
+        for (size_t index = 0; index < Count; index++) {
+            CHECK(dots[index] == first[index].Dot(second[index]));
+        }
+        CHECK(FixedKernels::Dot(a.data(), b.data(), 3 * Count) == sum);
+    }
+
+}
+
+TEST("FixedKernels match scalar Fixed") {
+    CheckKernels<Fixed<16, 16>>(701, 100);
+    CheckKernels<Fixed<32, 32>>(702, 10000);
+}
+
+TEST("Fixed 64-bit arithmetic") {
+    using F = Fixed<32, 32>;
+    const long double step = 0x1.0p-32L;
+    Test::Random random(703);
+    size_t wrong = 0;
+    for (size_t index = 0; index < 100000; index++) {
+        const F a(random.Spread(30000, 40));
+        const F b(random.Spread(30000, 40));
+        const long double ra = static_cast<long double>(a.GetRaw()) * step;
+        const long double rb = static_cast<long double>(b.GetRaw()) * step;
+        const long double product = ra * rb;
+        if (std::fabs(product) < 1e9L) {
+            wrong += std::fabs(static_cast<long double>((a * b).GetRaw()) * step - product) > step;
+        }
+        const long double quotient = ra / rb;
+        if (std::fabs(quotient) < 1e9L) {
+            wrong += std::fabs(static_cast<long double>((a / b).GetRaw()) * step - quotient) > step;
+        }
+        const long double root = std::sqrt(std::fabs(ra));
+        const F absolute = a < F(0) ? -a : a;
+        wrong += std::fabs(static_cast<long double>(Sqrt(absolute).GetRaw()) * step - root) > step;
+    }
+    CHECK(wrong == 0);
+    CHECK(F(3) * F(-2) == F(-6));
+    CHECK(F(-7) / F(2) == F(-3.5));
+    CHECK(Sqrt(F(2)).GetRaw() == 6074000999LL);
+}
+
+TEST("Fixed division by zero throws") {
+    auto throws = [](auto function) {
+        try {
+            function();
+        }
+        catch (const FixedException& exception) {
+            return std::string(exception.what()) == "Fixed division by zero";
+        }
+        return false;
+    };
+    CHECK(throws([] { return Fixed<16, 16>(3) / Fixed<16, 16>(0); }));
+    CHECK(throws([] { return Fixed<32, 32>(-3) / Fixed<32, 32>(0); }));
+    CHECK(throws([] { return Fixed<8, 8>(1) / Fixed<8, 8>::FromRaw(0); }));
+    CHECK(throws([] { return Rsqrt(Fixed<16, 16>(-2)); }));
+    CHECK(throws([] { return Rsqrt(Fixed<32, 32>(0)); }));
+    CHECK((Fixed<16, 16>(3) / Fixed<16, 16>(-2) == Fixed<16, 16>(-1.5)));
+    CHECK((Fixed<16, 16>::FromRaw(1) / Fixed<16, 16>(2) == Fixed<16, 16>()));
+}
+
@@ -0,0 +1,754 @@
+#include "Test.h"
+
+#include "Async/Async.h"
+#include "FastMath.h"
+#include "Geometry/AABB3Batch.h"
+#include "Geometry/ConvexHull3.h"
+#include "Geometry/Delaunay2.h"
+#include "Geometry/Predicates.h"
+#include "Geometry/Ray3.h"
+#include "Geometry/Ray3Packet.h"
+#include "Geometry/SweepAndPrune.h"
+#include "Geometry/Triangle3Batch.h"
+#include "Reduce.h"
+#include "VecKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Batched kernels against long double references, and against the scalar
+// paths they are required to match bit for bit
+
+using namespace Math;
+
+namespace {
+
+    constexpr size_t Count = 1 << 16;
+
+    std::vector<Vec3<float>> RandomVec3s(Test::Random& random, size_t count, double range) {
+        std::vector<Vec3<float>> result;
+        result.reserve(count);
+        for (size_t index = 0; index < count; index++) {
+            result.emplace_back(float(random.Uniform(-range, range)), float(random.Uniform(-range, range)),
+                float(random.Uniform(-range, range)));
+        }
+        return result;
+    }
+
+    // Fuzz one FastMath array function of one argument over [low, high)
+    template<typename Reference>
+    UlpStats<float> FuzzUnary(uint64_t seed, double low, double high, bool absolute,
+        void (*function)(const float*, float*, size_t), const Reference& reference) {
+        Test::Random random(seed);
+        std::vector<float> in(Count), out(Count);
+        for (float& value : in) {
+            value = float(random.Uniform(low, high));
+        }
+        function(in.data(), out.data(), Count);
+        UlpStats<float> stats;
+        for (size_t index = 0; index < Count; index++) {
+            // Absolute error bounds are measured in ulps of 1
+            stats.Add(out[index], reference(static_cast<long double>(in[index])), absolute ? 1.0L : 0.0L);
+        }
+        return stats;
+    }
+
+}
+
+TEST("VecKernels accuracy") {
+    Test::Random random(501);
+    const std::vector<Vec3<float>> a = RandomVec3s(random, Count, 100);
+    const std::vector<Vec3<float>> b = RandomVec3s(random, Count, 100);
+    std::vector<float> dots(Count);
+    std::vector<Vec3<float>> crosses(Count, Vec3<float>(0, 0, 0));
+    VecKernels::Dot(a.data(), b.data(), dots.data(), Count);
+    VecKernels::Cross(a.data(), b.data(), crosses.data(), Count);
+
+    UlpStats<float> dot, cross;
+    bool same = true;
+    for (size_t index = 0; index < Count; index++) {
+        const Vec3<long double> ra(a[index].GetX(), a[index].GetY(), a[index].GetZ());
+        const Vec3<long double> rb(b[index].GetX(), b[index].GetY(), b[index].GetZ());
+        long double terms = std::fabs(ra.GetX() * rb.GetX()) + std::fabs(ra.GetY() * rb.GetY())
+            + std::fabs(ra.GetZ() * rb.GetZ());
+        dot.Add(dots[index], ra.Dot(rb), terms);
+        const Vec3<long double> reference = ra.Cross(rb);
+        long double scale = ra.Magnitude() * rb.Magnitude();
+        cross.Add(crosses[index].GetX(), reference.GetX(), scale);
+        cross.Add(crosses[index].GetY(), reference.GetY(), scale);
+        cross.Add(crosses[index].GetZ(), reference.GetZ(), scale);
+        same = same && dots[index] == a[index].Dot(b[index]);
+    }
+    CHECK_BUDGET("VecKernels::Dot(Vec3)", dot, 2.5, 0.5);
+    CHECK_BUDGET("VecKernels::Cross(Vec3)", cross, 1.5, 0.3);
+    CHECK(same);
+
+    // The SoA overloads compute the same expressions as Vec3
+    std::vector<float> soa[6], soaDots(Count), soaCross[3];
+    for (size_t index = 0; index < Count; index++) {
+        soa[0].push_back(a[index].GetX());
+        soa[1].push_back(a[index].GetY());
+        soa[2].push_back(a[index].GetZ());
+        soa[3].push_back(b[index].GetX());
+        soa[4].push_back(b[index].GetY());
+        soa[5].push_back(b[index].GetZ());
+    }
+    for (std::vector<float>& component : soaCross) {
+        component.resize(Count);
+    }
+    VecKernels::Dot(soa[0].data(), soa[1].data(), soa[2].data(), soa[3].data(), soa[4].data(), soa[5].data(),
+        soaDots.data(), Count);
+    VecKernels::Cross(soa[0].data(), soa[1].data(), soa[2].data(), soa[3].data(), soa[4].data(), soa[5].data(),
+        soaCross[0].data(), soaCross[1].data(), soaCross[2].data(), Count);
+    bool sameSoa = true;
+    for (size_t index = 0; index < Count; index++) {
+        sameSoa = sameSoa && soaDots[index] == dots[index] && soaCross[0][index] == crosses[index].GetX()
+            && soaCross[1][index] == crosses[index].GetY() && soaCross[2][index] == crosses[index].GetZ();
+    }
+    CHECK(sameSoa);
+}
+
+TEST("FastMath accuracy") {
+    using FastMath::Accuracy;
+    auto sin = [](long double x) { return std::sin(x); };
+    auto cos = [](long double x) { return std::cos(x); };
+    auto exp = [](long double x) { return std::exp(x); };
+    auto log = [](long double x) { return std::log(x); };
+    auto sqrt = [](long double x) { return std::sqrt(x); };
+
+    // PRECISE budgets are the ulp bounds documented in FastMath.h
+    CHECK_BUDGET("Sin<PRECISE>", FuzzUnary(601, -8192, 8192, false, FastMath::Sin<Accuracy::PRECISE>, sin), 1.6, 0.5);
+    CHECK_BUDGET("Cos<PRECISE>", FuzzUnary(602, -8192, 8192, false, FastMath::Cos<Accuracy::PRECISE>, cos), 1.6, 0.5);
+    CHECK_BUDGET("Exp<PRECISE>", FuzzUnary(603, -87, 88.7, false, FastMath::Exp<Accuracy::PRECISE>, exp), 1, 0.5);
+    CHECK_BUDGET("Log<PRECISE>", FuzzUnary(604, 1e-30, 1e30, false, FastMath::Log<Accuracy::PRECISE>, log), 0.9, 0.5);
+    CHECK_BUDGET("Sqrt<PRECISE>", FuzzUnary(605, 0, 1e30, false, FastMath::Sqrt<Accuracy::PRECISE>, sqrt), 0.9, 0.5);
+
+    // FAST budgets are the absolute bounds in ulps of 1, and the relative
+    // bounds as ulps at the bottom of a binade (2^-24 relative per ulp)
+    CHECK_BUDGET("Sin<FAST>", FuzzUnary(611, -8192, 8192, true, FastMath::Sin<Accuracy::FAST>, sin), 6.8e-4 * 0x1p23, 3000);
+    CHECK_BUDGET("Exp<FAST>", FuzzUnary(613, -87, 88.7, false, FastMath::Exp<Accuracy::FAST>, exp), 1.6e-4 * 0x1p24, 1500);
+    CHECK_BUDGET("Log<FAST>", FuzzUnary(614, 1e-30, 1e30, true, FastMath::Log<Accuracy::FAST>, log), 2.9e-5 * 0x1p23, 150);
+    CHECK_BUDGET("Sqrt<FAST>", FuzzUnary(615, 0, 1e30, false, FastMath::Sqrt<Accuracy::FAST>, sqrt), 9e-6 * 0x1p24, 80);
+
+    Test::Random random(620);
+    std::vector<float> y(Count), x(Count), precise(Count), fast(Count);
+    for (size_t index = 0; index < Count; index++) {
+        y[index] = float(random.Spread(100, 20));
+        x[index] = float(random.Spread(100, 20));
+    }
+    FastMath::Atan2<Accuracy::PRECISE>(y.data(), x.data(), precise.data(), Count);
+    FastMath::Atan2<Accuracy::FAST>(y.data(), x.data(), fast.data(), Count);
+    UlpStats<float> atan2Precise, atan2Fast;
+    for (size_t index = 0; index < Count; index++) {
+        long double reference = std::atan2(static_cast<long double>(y[index]), static_cast<long double>(x[index]));
+        atan2Precise.Add(precise[index], reference);
+        atan2Fast.Add(fast[index], reference, 1.0L);
+    }
+    CHECK_BUDGET("Atan2<PRECISE>", atan2Precise, 3.2, 1);
+    CHECK_BUDGET("Atan2<FAST>", atan2Fast, 1.2e-5 * 0x1p23, 60);
+}
+
+TEST("Reduce accuracy") {
+    Test::Random random(701);
+    std::vector<float> a(Count), b(Count);
+    for (size_t index = 0; index < Count; index++) {
+        a[index] = float(random.Spread(100, 16));
+        b[index] = float(random.Spread(100, 16));
+    }
+    long double sum = 0, sumTerms = 0, dot = 0, dotTerms = 0;
+    for (size_t index = 0; index < Count; index++) {
+        sum += a[index];
+        sumTerms += std::fabs(a[index]);
+        dot += static_cast<long double>(a[index]) * b[index];
+        dotTerms += std::fabs(static_cast<long double>(a[index]) * b[index]);
+    }
+    UlpStats<float> sums, dots, async;
+    sums.Add(Reduce::Sum(a.data(), a.size()), sum, sumTerms);
+    dots.Add(Reduce::Dot(a.data(), b.data(), a.size()), dot, dotTerms);
+    ThreadPool pool(2);
+    Async::Options options;
+    options.pool = &pool;
+    options.grain = 1024;
+    auto future = Async::Sum(a.data(), Count, options);
+    async.Add(future.get(), sum, sumTerms);
+    // Summing n values has an error of at most about n ulps of the sum of
+    // their magnitudes, much less in practice
+    CHECK_BUDGET("Reduce::Sum", sums, 64, 64);
+    CHECK_BUDGET("Reduce::Dot", dots, 64, 64);
+    CHECK_BUDGET("Async::Sum", async, 64, 64);
+}
+
+TEST("Async::Transform matches Mat3::Multiply") {
+    Test::Random random(801);
+    const std::vector<Vec3<float>> in = RandomVec3s(random, Count, 100);
+    std::vector<Vec3<float>> out(Count, Vec3<float>(0, 0, 0));
+    const Mat3<float> matrix(0.8f, -0.6f, 0, 0.6f, 0.8f, 0, 0, 0, 1);
+    ThreadPool pool(2);
+    Async::Options options;
+    options.pool = &pool;
+    Async::Transform(matrix, in.data(), out.data(), Count, options).get();
+    bool same = true;
+    for (size_t index = 0; index < Count; index++) {
+        const Vec3<float> expected = matrix.Multiply(in[index]);
+        same = same && out[index].GetX() == expected.GetX() && out[index].GetY() == expected.GetY()
+            && out[index].GetZ() == expected.GetZ();
+    }
+    CHECK(same);
+}
+
+TEST("Batched intersections match scalar tests") {
+    constexpr size_t Lanes = 8;
+    constexpr size_t Used = 5;
+    Test::Random random(901);
+    bool same = true;
+    for (size_t sample = 0; sample < 10000; sample++) {
+        const Ray3<float> ray(RandomVec3s(random, 1, 10)[0], RandomVec3s(random, 1, 1)[0]);
+        const std::vector<Vec3<float>> corners = RandomVec3s(random, 2 * Used, 10);
+        const std::vector<Vec3<float>> vertices = RandomVec3s(random, 3 * Used, 10);
+        AABB3Batch<float, Lanes> boxes;
+        Triangle3Batch<float, Lanes> triangles;
+        for (size_t lane = 0; lane < Used; lane++) {
+            boxes.Set(lane, AABB3<float>(corners[2 * lane], corners[2 * lane + 1]));
+            triangles.Set(lane, Triangle3<float>(vertices[3 * lane], vertices[3 * lane + 1], vertices[3 * lane + 2]));
+        }
+        const HitResult<float, Lanes> boxHits = boxes.Intersect(ray);
+        const HitResult<float, Lanes> triangleHits = triangles.Intersect(ray);
+        for (size_t lane = 0; lane < Lanes; lane++) {
+            float boxDistance = std::numeric_limits<float>::infinity();
+            float triangleDistance = std::numeric_limits<float>::infinity();
+            bool boxHit = false, triangleHit = false;
+            if (lane < Used) {
+                boxHit = ray.Intersect(AABB3<float>(corners[2 * lane], corners[2 * lane + 1]), boxDistance);
+                triangleHit = ray.Intersect(
+                    Triangle3<float>(vertices[3 * lane], vertices[3 * lane + 1], vertices[3 * lane + 2]),
+                    triangleDistance);
+            }
+            // Misses, including unused lanes, must report infinity
+            same = same && boxHits.Hit(lane) == boxHit
+                && boxHits.distances[lane] == (boxHit ? boxDistance : std::numeric_limits<float>::infinity());
+            same = same && triangleHits.Hit(lane) == triangleHit
+                && triangleHits.distances[lane] == (triangleHit ? triangleDistance : std::numeric_limits<float>::infinity());
+        }
+    }
+    CHECK(same);
+
+    // Axis parallel rays whose origin lies on a face plane of the box give
+    // 0 * inf in the slab test. The box is closed, so they hit exactly when
+    // the origin is within the box on the axes the ray does not move along.
+    const AABB3<float> box(Vec3<float>(0, 0, 0), Vec3<float>(1, 1, 1));
+    std::vector<Ray3<float>> rays;
+    std::vector<bool> inside;
+    const float offsets[] = { 0.0f, 1.0f, 0.5f, -0.5f, 1.5f };
+    for (int axis = 0; axis < 3; axis++) {
+        int along = (axis + 1) % 3;
+        for (float offset : offsets) {
+            for (float sign : { 1.0f, -1.0f }) {
+                float position[3] = { 0.5f, 0.5f, 0.5f };
+                float direction[3] = { 0.0f, 0.0f, 0.0f };
+                position[axis] = offset;
+                position[along] = sign > 0 ? -2.0f : 3.0f;
+                direction[along] = sign;
+                rays.emplace_back(Vec3<float>(position[0], position[1], position[2]),
+                    Vec3<float>(direction[0], direction[1], direction[2]));
+                inside.push_back(offset >= 0.0f && offset <= 1.0f);
+            }
+        }
+    }
+    AABB3Batch<float, Lanes> single;
+    single.Set(0, box);
+    bool expected = true;
+    same = true;
+    for (size_t first = 0; first < rays.size(); first += Lanes) {
+        Ray3Packet<float, Lanes> packet;
+        for (size_t lane = 0; lane < Lanes && first + lane < rays.size(); lane++) {
+            packet.Set(lane, rays[first + lane]);
+        }
+        const HitResult<float, Lanes> packetHits = packet.Intersect(box);
+        for (size_t lane = 0; lane < Lanes && first + lane < rays.size(); lane++) {
+            const Ray3<float>& ray = rays[first + lane];
+            float distance = 0;
+            bool hit = ray.Intersect(box, distance);
+            float reported = hit ? distance : std::numeric_limits<float>::infinity();
+            expected = expected && hit == inside[first + lane] && (!hit || distance == 2.0f);
+            const HitResult<float, Lanes> boxHits = single.Intersect(ray);
+            same = same && boxHits.Hit(0) == hit && boxHits.distances[0] == reported;
+            same = same && packetHits.Hit(lane) == hit && packetHits.distances[lane] == reported;
+        }
+    }
+    CHECK(expected);
+    CHECK(same);
+}
+
+namespace {
+
+    int Sign(double value) {
+        return (value > 0) - (value < 0);
+    }
+
+    uint64_t EdgeKey(uint32_t from, uint32_t to) {
+        return (uint64_t(from) << 32) | to;
+    }
+
+    template<typename Point>
+    void Shuffle(std::vector<Point>& points, Test::Random& random) {
+        for (size_t index = points.size(); index > 1; index--) {
+            std::swap(points[index - 1], points[size_t(random.Uniform(0, double(index)))]);
+        }
+    }
+
+    // Check a Delaunay triangulation: triangles are counter-clockwise, every
+    // distinct point is a vertex exactly once, no directed edge repeats,
+    // there are 2n - 2 - h triangles for n distinct points with h on the hull
+    // and no point lies inside a circumcircle. With brute every point is
+    // tested against every circumcircle, otherwise each edge against the
+    // vertex across it, which implies the same for a triangulation.
+    void CheckDelaunay(const std::vector<Vec2<double>>& points, const std::vector<uint32_t>& triangles,
+        const std::vector<uint32_t>& hull, bool brute) {
+        std::vector<std::pair<double, double>> distinct;
+        for (const Vec2<double>& point : points) {
+            distinct.emplace_back(point.GetX(), point.GetY());
+        }
+        std::sort(distinct.begin(), distinct.end());
+        distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+        std::unordered_map<uint64_t, uint32_t> opposite;
+        std::vector<bool> used(points.size(), false);
+        bool counterClockwise = true, unique = true;
+        for (size_t first = 0; first < triangles.size(); first += 3) {
+            const uint32_t* vertices = &triangles[first];
+            counterClockwise = counterClockwise
+                && Predicates::Orient2D(points[vertices[0]], points[vertices[1]], points[vertices[2]]) > 0;
+            for (int side = 0; side < 3; side++) {
+                used[vertices[side]] = true;
+                uint64_t key = EdgeKey(vertices[side], vertices[(side + 1) % 3]);
+                unique = opposite.emplace(key, vertices[(side + 2) % 3]).second && unique;
+            }
+        }
+        size_t open = 0;
+        bool empty = true;
+        for (const auto& [key, vertex] : opposite) {
+            auto reverse = opposite.find(EdgeKey(uint32_t(key), uint32_t(key >> 32)));
+            if (reverse == opposite.end()) {
+                open++;
+            }
+            else if (!brute) {
+                empty = empty && Predicates::InCircle(points[key >> 32], points[uint32_t(key)], points[vertex],
+                    points[reverse->second]) <= 0;
+            }
+        }
+        if (brute) {
+            for (size_t first = 0; first < triangles.size(); first += 3) {
+                for (const Vec2<double>& point : points) {
+                    empty = empty && Predicates::InCircle(points[triangles[first]], points[triangles[first + 1]],
+                        points[triangles[first + 2]], point) <= 0;
+                }
+            }
+        }
+        CHECK(counterClockwise);
+        CHECK(unique);
+        CHECK(size_t(std::count(used.begin(), used.end(), true)) == distinct.size());
+        CHECK(triangles.size() / 3 == 2 * distinct.size() - 2 - hull.size());
+        CHECK(open == hull.size());
+        CHECK(empty);
+    }
+
+    // Check a convex hull: no point lies outside any face, every directed
+    // edge appears once and its reverse once, so each edge joins exactly two
+    // faces, and the surface satisfies V - E + F = 2
+    void CheckHull(const std::vector<Vec3<double>>& points, const std::vector<uint32_t>& triangles) {
+        std::unordered_set<uint64_t> edges;
+        std::unordered_set<uint32_t> vertices;
+        bool unique = true;
+        for (size_t first = 0; first < triangles.size(); first += 3) {
+            for (int side = 0; side < 3; side++) {
+                vertices.insert(triangles[first + side]);
+                unique = edges.insert(EdgeKey(triangles[first + side], triangles[first + (side + 1) % 3])).second
+                    && unique;
+            }
+        }
+        bool closed = true;
+        for (uint64_t key : edges) {
+            closed = closed && edges.count(EdgeKey(uint32_t(key), uint32_t(key >> 32))) == 1;
+        }
+        bool inside = true;
+        for (size_t first = 0; first < triangles.size(); first += 3) {
+            for (const Vec3<double>& point : points) {
+                inside = inside && Predicates::Orient3D(points[triangles[first]], points[triangles[first + 1]],
+                    points[triangles[first + 2]], point) >= 0;
+            }
+        }
+        long long euler = (long long)vertices.size() - (long long)(edges.size() / 2) + (long long)(triangles.size() / 3);
+        CHECK(!triangles.empty());
+        CHECK(unique);
+        CHECK(closed);
+        CHECK(euler == 2);
+        CHECK(inside);
+    }
+
+}
+
+TEST("Predicates take the exact path on near degenerate input") {
+    // c = (0.5 + i ulp, 0.5 + j ulp) against the line through (12, 12) and
+    // (24, 24). The exact determinant is 12 (cy - cx), while evaluating it
+    // in double gets the sign wrong for many of these points.
+    const double ulp = std::nextafter(0.5, 1.0) - 0.5;
+    size_t wrong2D = 0, wrong3D = 0, wrongCircle = 0;
+    bool exact2D = true, exact3D = true, exactCircle = true;
+    for (int i = -20; i <= 20; i++) {
+        for (int j = -20; j <= 20; j++) {
+            const Vec2<double> a(12, 12), b(24, 24), c(0.5 + i * ulp, 0.5 + j * ulp);
+            int expected = Sign(j - i);
+            exact2D = exact2D && Predicates::Orient2D(a, b, c) == expected;
+            double naive = Mat2<double>(a.GetX() - c.GetX(), a.GetY() - c.GetY(),
+                b.GetX() - c.GetX(), b.GetY() - c.GetY()).Determinant();
+            wrong2D += Sign(naive) != expected;
+        }
+    }
+
+    // a, b, c span the plane z = x, so the orientation of d is the sign of
+    // dz - dx times that of any point above the plane
+    const Vec3<double> pa(12, 0, 12), pb(24, 6, 24), pc(18, -9, 18);
+    int above = Predicates::Orient3D(pa, pb, pc, Vec3<double>(0, 0, 1));
+    CHECK(above != 0);
+    for (int i = -20; i <= 20; i++) {
+        for (int j = -20; j <= 20; j++) {
+            const Vec3<double> d(0.5 + i * ulp, 0.5, 0.5 + j * ulp);
+            int expected = above * Sign(j - i);
+            exact3D = exact3D && Predicates::Orient3D(pa, pb, pc, d) == expected;
+            double naive = Mat3<double>(
+                pa.GetX() - d.GetX(), pa.GetY() - d.GetY(), pa.GetZ() - d.GetZ(),
+                pb.GetX() - d.GetX(), pb.GetY() - d.GetY(), pb.GetZ() - d.GetZ(),
+                pc.GetX() - d.GetX(), pc.GetY() - d.GetY(), pc.GetZ() - d.GetZ()).Determinant();
+            wrong3D += Sign(naive) != expected;
+        }
+    }
+
+    // d = (3 + i ulp(3), 4 + j ulp(4)) against the circle of radius 5. Then
+    // |d|^2 - 25 = (6i + 16j) 2^-51 plus squares of the offsets, so d is
+    // inside exactly when 6i + 16j < 0 and on the circle only for i = j = 0.
+    const Vec2<double> ca(5, 0), cb(0, 5), cc(-5, 0);
+    const double ulp3 = std::nextafter(3.0, 4.0) - 3.0, ulp4 = std::nextafter(4.0, 5.0) - 4.0;
+    for (int i = -20; i <= 20; i++) {
+        for (int j = -20; j <= 20; j++) {
+            const Vec2<double> d(3 + i * ulp3, 4 + j * ulp4);
+            int linear = 6 * i + 16 * j;
+            int expected = linear != 0 ? -Sign(linear) : (i == 0 && j == 0 ? 0 : -1);
+            exactCircle = exactCircle && Predicates::InCircle(ca, cb, cc, d) == expected;
+            double adx = ca.GetX() - d.GetX(), ady = ca.GetY() - d.GetY();
+            double bdx = cb.GetX() - d.GetX(), bdy = cb.GetY() - d.GetY();
+            double cdx = cc.GetX() - d.GetX(), cdy = cc.GetY() - d.GetY();
+            double naive = Mat3<double>(adx, ady, adx * adx + ady * ady, bdx, bdy, bdx * bdx + bdy * bdy,
+                cdx, cdy, cdx * cdx + cdy * cdy).Determinant();
+            wrongCircle += Sign(naive) != expected;
+        }
+    }
+    std::cout << "    double evaluation wrong for " << wrong2D << " Orient2D, " << wrong3D << " Orient3D and "
+        << wrongCircle << " InCircle cases of 1681 each\n";
+    CHECK(exact2D);
+    CHECK(exact3D);
+    CHECK(exactCircle);
+    CHECK(wrong2D > 0);
+    CHECK(wrong3D > 0);
+    CHECK(wrongCircle > 0);
+}
+
+TEST("Delaunay2 triangulations are Delaunay") {
+    Test::Random random(1101);
+    Delaunay2<double> delaunay;
+    auto check = [&](const std::vector<Vec2<double>>& points, bool brute) {
+        delaunay.Triangulate(points.data(), points.size());
+        CheckDelaunay(points, delaunay.GetTriangles(), delaunay.GetHull(), brute);
+    };
+
+    std::vector<Vec2<double>> uniform;
+    for (size_t index = 0; index < 2000; index++) {
+        uniform.emplace_back(random.Uniform(-1, 1), random.Uniform(-1, 1));
+    }
+    check(uniform, true);
+
+    // Every grid cell is cocircular
+    std::vector<Vec2<double>> grid;
+    for (int x = 0; x < 30; x++) {
+        for (int y = 0; y < 30; y++) {
+            grid.emplace_back(x, y);
+        }
+    }
+    Shuffle(grid, random);
+    check(grid, true);
+
+    // The 36 integer points on a circle of radius 65, all on the hull
+    std::vector<Vec2<double>> circle;
+    for (int x = -65; x <= 65; x++) {
+        for (int y = -65; y <= 65; y++) {
+            if (x * x + y * y == 65 * 65) {
+                circle.emplace_back(x, y);
+            }
+        }
+    }
+    check(circle, true);
+    CHECK(delaunay.GetHull().size() == circle.size());
+    circle.emplace_back(0, 0);
+    check(circle, true);
+
+    std::vector<Vec2<double>> collinear;
+    for (int index = 0; index < 100; index++) {
+        collinear.emplace_back(index, 2 * index + 1);
+    }
+    Shuffle(collinear, random);
+    CHECK(delaunay.Triangulate(collinear.data(), collinear.size()).empty());
+
+    std::vector<Vec2<double>> duplicates(uniform.begin(), uniform.begin() + 500);
+    duplicates.insert(duplicates.end(), uniform.begin(), uniform.begin() + 500);
+    duplicates.insert(duplicates.end(), grid.begin(), grid.begin() + 100);
+    duplicates.insert(duplicates.end(), grid.begin(), grid.begin() + 100);
+    duplicates.insert(duplicates.end(), grid.begin(), grid.begin() + 100);
+    Shuffle(duplicates, random);
+    check(duplicates, true);
+
+    // Large enough for the pool to order the points in parallel
+    std::vector<Vec2<double>> large;
+    for (size_t index = 0; index < 200000; index++) {
+        large.emplace_back(random.Uniform(-1, 1), random.Uniform(-1, 1));
+    }
+    ThreadPool pool(2);
+    Delaunay2<double> pooled(pool);
+    pooled.Triangulate(large.data(), large.size());
+    CheckDelaunay(large, pooled.GetTriangles(), pooled.GetHull(), false);
+}
+
+TEST("ConvexHull3 hulls are closed and convex") {
+    Test::Random random(1201);
+    ConvexHull3<double> hull;
+    auto check = [&](const std::vector<Vec3<double>>& points) {
+        hull.Build(points.data(), points.size());
+        CheckHull(points, hull.GetTriangles());
+    };
+
+    std::vector<Vec3<double>> cube;
+    for (size_t index = 0; index < 5000; index++) {
+        cube.emplace_back(random.Uniform(-1, 1), random.Uniform(-1, 1), random.Uniform(-1, 1));
+    }
+    check(cube);
+
+    std::vector<Vec3<double>> sphere;
+    while (sphere.size() < 2000) {
+        const Vec3<double> point(random.Uniform(-1, 1), random.Uniform(-1, 1), random.Uniform(-1, 1));
+        double length = point.Magnitude();
+        if (length > 0.1 && length <= 1) {
+            sphere.push_back(point.Scale(1 / length));
+        }
+    }
+    check(sphere);
+
+    // Points on the faces of the grid are coplanar with its hull faces
+    std::vector<Vec3<double>> grid;
+    for (int x = 0; x < 6; x++) {
+        for (int y = 0; y < 6; y++) {
+            for (int z = 0; z < 6; z++) {
+                grid.emplace_back(x, y, z);
+            }
+        }
+    }
+    Shuffle(grid, random);
+    check(grid);
+
+    // Square pyramid with points exactly on its base, on its sides, along its
+    // edges and inside
+    std::vector<Vec3<double>> pyramid = { Vec3<double>(0, 0, 1) };
+    for (int x = -4; x <= 4; x++) {
+        for (int y = -4; y <= 4; y++) {
+            pyramid.emplace_back(x * 0.25, y * 0.25, 0);
+        }
+    }
+    for (int level = 1; level < 4; level++) {
+        double half = 1 - level * 0.25;
+        for (int step = -level; step <= level; step++) {
+            double along = half * step / level;
+            pyramid.emplace_back(along, half, level * 0.25);
+            pyramid.emplace_back(along, -half, level * 0.25);
+            pyramid.emplace_back(half, along, level * 0.25);
+            pyramid.emplace_back(-half, along, level * 0.25);
+            pyramid.emplace_back(along * 0.5, along * 0.25, level * 0.125);
+        }
+    }
+    Shuffle(pyramid, random);
+    check(pyramid);
+
+    std::vector<Vec3<double>> flat;
+    for (size_t index = 0; index < 100; index++) {
+        flat.emplace_back(random.Uniform(-1, 1), random.Uniform(-1, 1), 2);
+    }
+    CHECK(hull.Build(flat.data(), flat.size()).empty());
+
+    // Large enough for the pool to partition the points in parallel
+    std::vector<Vec3<double>> large;
+    for (size_t index = 0; index < 60000; index++) {
+        large.emplace_back(random.Uniform(-1, 1), random.Uniform(-1, 1), random.Uniform(-1, 1));
+    }
+    ThreadPool pool(2);
+    ConvexHull3<double> pooled(pool);
+    pooled.Build(large.data(), large.size());
+    CheckHull(large, pooled.GetTriangles());
+}
+
+namespace {
+
+    using BoxPairs = std::vector<std::pair<uint32_t, uint32_t>>;
+
+    bool Overlap(const AABB3<float>& a, const AABB3<float>& b) {
+        return a.GetMin().GetX() <= b.GetMax().GetX() && b.GetMin().GetX() <= a.GetMax().GetX()
+            && a.GetMin().GetY() <= b.GetMax().GetY() && b.GetMin().GetY() <= a.GetMax().GetY()
+            && a.GetMin().GetZ() <= b.GetMax().GetZ() && b.GetMin().GetZ() <= a.GetMax().GetZ();
+    }
+
+    // Every overlapping pair by testing all of them
+    BoxPairs BrutePairs(const std::vector<AABB3<float>>& boxes) {
+        BoxPairs result;
+        for (uint32_t first = 0; first < boxes.size(); first++) {
+            for (uint32_t second = first + 1; second < boxes.size(); second++) {
+                if (Overlap(boxes[first], boxes[second])) {
+                    result.emplace_back(first, second);
+                }
+            }
+        }
+        return result;
+    }
+
+    // Every overlapping pair by testing each box against the boxes that start
+    // before it ends along x, in std::sort order. Fast enough for many boxes
+    // and independent of the sorts in SweepAndPrune.
+    BoxPairs SortedPairs(const std::vector<AABB3<float>>& boxes) {
+        std::vector<uint32_t> order(boxes.size());
+        for (uint32_t index = 0; index < order.size(); index++) {
+            order[index] = index;
+        }
+        std::sort(order.begin(), order.end(), [&](uint32_t first, uint32_t second) {
+            return boxes[first].GetMin().GetX() < boxes[second].GetMin().GetX();
+        });
+        BoxPairs result;
+        for (size_t index = 0; index < order.size(); index++) {
+            const AABB3<float>& box = boxes[order[index]];
+            for (size_t next = index + 1;
+                next < order.size() && boxes[order[next]].GetMin().GetX() <= box.GetMax().GetX(); next++) {
+                if (Overlap(box, boxes[order[next]])) {
+                    result.emplace_back(std::min(order[index], order[next]), std::max(order[index], order[next]));
+                }
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    BoxPairs Sorted(const std::vector<SweepAndPrune<float>::Pair>& pairs) {
+        BoxPairs result;
+        for (const SweepAndPrune<float>::Pair& pair : pairs) {
+            result.emplace_back(pair.first, pair.second);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // Boxes of up to size along each axis, spread wider along x so the
+    // sweep keeps one axis from frame to frame
+    std::vector<AABB3<float>> RandomBoxes(Test::Random& random, size_t count, double range, double size) {
+        std::vector<AABB3<float>> boxes;
+        for (size_t index = 0; index < count; index++) {
+            const Vec3<float> corner(float(random.Uniform(0, 4 * range)), float(random.Uniform(0, range)),
+                float(random.Uniform(0, range)));
+            const Vec3<float> extent(float(random.Uniform(0, size)), float(random.Uniform(0, size)),
+                float(random.Uniform(0, size)));
+            boxes.emplace_back(corner, corner.Add(extent));
+        }
+        return boxes;
+    }
+
+    // Move every box by up to step along each axis
+    void Move(std::vector<AABB3<float>>& boxes, Test::Random& random, double step) {
+        for (AABB3<float>& box : boxes) {
+            const Vec3<float> offset(float(random.Uniform(-step, step)), float(random.Uniform(-step, step)),
+                float(random.Uniform(-step, step)));
+            box = AABB3<float>(box.GetMin().Add(offset), box.GetMax().Add(offset));
+        }
+    }
+
+}
+
+TEST("SweepAndPrune finds the same pairs as brute force") {
+    Test::Random random(1501);
+    SweepAndPrune<float> broadphase;
+    std::vector<AABB3<float>> boxes = RandomBoxes(random, 2000, 10, 0.6);
+
+    // Identical, degenerate and touching boxes, including -0 against +0
+    const AABB3<float> unit(Vec3<float>(1, 1, 1), Vec3<float>(2, 2, 2));
+    for (int copy = 0; copy < 5; copy++) {
+        boxes.push_back(unit);
+    }
+    boxes.emplace_back(Vec3<float>(2, 2, 2), Vec3<float>(3, 3, 3));
+    boxes.emplace_back(Vec3<float>(2, 1, 1), Vec3<float>(2, 2, 2));
+    boxes.emplace_back(Vec3<float>(1.5f, 1.5f, 1.5f), Vec3<float>(1.5f, 1.5f, 1.5f));
+    boxes.emplace_back(Vec3<float>(1.5f, 1.5f, 1.5f), Vec3<float>(1.5f, 1.5f, 1.5f));
+    boxes.emplace_back(Vec3<float>(-1, -1, -1), Vec3<float>(-0.0f, -0.0f, -0.0f));
+    boxes.emplace_back(Vec3<float>(0, 0, 0), Vec3<float>(1, 1, 1));
+    boxes.emplace_back(Vec3<float>(2.5f, 0, 0), Vec3<float>(2.5f, 3, 3));
+
+    // Small moves keep the insertion sort within its budget, a shuffle
+    // forces the radix sort, and a new count restarts from scratch
+    bool same = true;
+    size_t found = 0;
+    for (int frame = 0; frame < 12; frame++) {
+        if (frame == 8) {
+            Shuffle(boxes, random);
+        }
+        else if (frame == 10) {
+            boxes.erase(boxes.begin() + 1500, boxes.end());
+        }
+        else if (frame > 0) {
+            Move(boxes, random, 0.05);
+        }
+        broadphase.Update(boxes.data(), boxes.size());
+        const BoxPairs pairs = Sorted(broadphase.FindPairs());
+        same = same && pairs == BrutePairs(boxes);
+        found += pairs.size();
+    }
+    std::cout << "    " << found << " pairs over 12 frames\n";
+    CHECK(same);
+
+    // Single box updates
+    boxes[3] = boxes[4];
+    broadphase.Update(3, boxes[3]);
+    CHECK(Sorted(broadphase.FindPairs()) == BrutePairs(boxes));
+
+    std::vector<AABB3<float>> tiny(boxes.begin(), boxes.begin() + 1);
+    broadphase.Update(tiny.data(), tiny.size());
+    CHECK(broadphase.FindPairs().empty());
+
+    // Large enough for the pool to sort and sweep in several chunks, with
+    // the same output order as the serial path
+    std::vector<AABB3<float>> many = RandomBoxes(random, 60000, 40, 0.5);
+    ThreadPool pool(2);
+    SweepAndPrune<float> pooled(pool);
+    SweepAndPrune<float> serial;
+    bool ordered = true;
+    same = true;
+    for (int frame = 0; frame < 3; frame++) {
+        pooled.Update(many.data(), many.size());
+        serial.Update(many.data(), many.size());
+        const auto& pooledPairs = pooled.FindPairs();
+        const auto& serialPairs = serial.FindPairs();
+        ordered = ordered && pooledPairs.size() == serialPairs.size();
+        for (size_t index = 0; ordered && index < pooledPairs.size(); index++) {
+            ordered = pooledPairs[index].first == serialPairs[index].first
+                && pooledPairs[index].second == serialPairs[index].second;
+        }
+        same = same && Sorted(pooledPairs) == SortedPairs(many);
+        Move(many, random, 0.05);
+    }
+    CHECK(ordered);
+    CHECK(same);
+}
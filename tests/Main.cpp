@@ -0,0 +1,53 @@
+#include "Test.h"
+
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+// Usage: MathUtil_tests [--tests | --benchmarks] [--strict] [name filter]
+int main(int argc, char** argv) {
+    bool tests = true;
+    bool benchmarks = true;
+    const char* filter = nullptr;
+    for (int index = 1; index < argc; index++) {
+        if (std::strcmp(argv[index], "--tests") == 0) {
+            benchmarks = false;
+        }
+        else if (std::strcmp(argv[index], "--benchmarks") == 0) {
+            tests = false;
+        }
+        else if (std::strcmp(argv[index], "--strict") == 0) {
+            Test::Strict() = true;
+        }
+        else {
+            filter = argv[index];
+        }
+    }
+
+    size_t run = 0;
+    size_t failed = 0;
+    for (const Test::Case& testCase : Test::Registry()) {
+        bool wanted = testCase.kind == Test::Kind::TEST ? tests : benchmarks;
+        if (!wanted || (filter != nullptr && std::strstr(testCase.name, filter) == nullptr)) {
+            continue;
+        }
+        std::cout << testCase.name << "\n";
+        Test::Failures() = 0;
+        try {
+            testCase.function();
+        }
+        catch (const std::exception& exception) {
+            Test::Fail(__FILE__, __LINE__, std::string("unexpected exception: ") + exception.what());
+        }
+        run++;
+        if (Test::Failures() != 0) {
+            failed++;
+        }
+    }
+
+    std::cout << run - failed << " of " << run << " cases passed\n";
+    if (!Test::Optimized && benchmarks) {
+        std::cout << "Speedup budgets are not enforced in unoptimized builds\n";
+    }
+    return run == 0 || failed != 0 ? 1 : 0;
+}
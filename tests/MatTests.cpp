@@ -0,0 +1,402 @@
+#include "Test.h"
+
+#include "CachedMat3.h"
+#include "Mat.h"
+#include "Mat2.h"
+#include "Mat3.h"
+#include "Vec2.h"
+#include "Vec3.h"
+
+#include <array>
+#include <cmath>
+#include <string>
+#include <utility>
+
+// Mat2, Mat3 and Mat fuzzed against the same templates in long double.
+// Products and determinants measure their error in ulps of the sum of the
+// magnitudes of their terms. Inverse and Solve use diagonally dominant
+// matrices, whose condition number is small, and measure their error in ulps
+// of the largest element of the exact result.
+
+using namespace Math;
+
+namespace {
+
+    constexpr size_t Samples = 50000;
+
+    template<typename T, size_t N>
+    struct Square {
+        std::array<T, N * N> values;
+
+        T operator()(size_t row, size_t col) const { return values[row * N + col]; }
+    };
+
+    // Entries spread over many binades, or a diagonally dominant matrix
+    // when conditioned is set
+    template<typename T, size_t N>
+    Square<T, N> RandomSquare(Test::Random& random, bool conditioned) {
+        Square<T, N> result;
+        for (size_t row = 0; row < N; row++) {
+            for (size_t col = 0; col < N; col++) {
+                double value = conditioned ? random.Uniform(-1, 1) : random.Spread(100, 16);
+                if (conditioned && row == col) {
+                    value += value < 0 ? -double(N) : double(N);
+                }
+                result.values[row * N + col] = T(value);
+            }
+        }
+        return result;
+    }
+
+    template<typename T, size_t N>
+    Square<long double, N> Promote(const Square<T, N>& square) {
+        Square<long double, N> result;
+        for (size_t index = 0; index < N * N; index++) {
+            result.values[index] = square.values[index];
+        }
+        return result;
+    }
+
+    template<typename T>
+    Mat2<T> ToMat2(const Square<T, 2>& m) {
+        return Mat2<T>(m(0, 0), m(0, 1), m(1, 0), m(1, 1));
+    }
+
+    template<typename T>
+    Mat3<T> ToMat3(const Square<T, 3>& m) {
+        return Mat3<T>(m(0, 0), m(0, 1), m(0, 2), m(1, 0), m(1, 1), m(1, 2), m(2, 0), m(2, 1), m(2, 2));
+    }
+
+    template<typename T>
+    Mat<T, 4, 4> ToMat4(const Square<T, 4>& m) {
+        return Mat<T, 4, 4>(
+            m(0, 0), m(0, 1), m(0, 2), m(0, 3), m(1, 0), m(1, 1), m(1, 2), m(1, 3),
+            m(2, 0), m(2, 1), m(2, 2), m(2, 3), m(3, 0), m(3, 1), m(3, 2), m(3, 3));
+    }
+
+    // Mat2 and Mat3 have no element access, so read columns through
+    // products with the unit vectors, which are exact
+    template<typename T>
+    Square<T, 2> Elements(const Mat2<T>& mat) {
+        Square<T, 2> result;
+        for (size_t col = 0; col < 2; col++) {
+            const Vec2<T> column = mat.Multiply(Vec2<T>(T(col == 0), T(col == 1)));
+            result.values[col] = column.GetX();
+            result.values[2 + col] = column.GetY();
+        }
+        return result;
+    }
+
+    template<typename T>
+    Square<T, 3> Elements(const Mat3<T>& mat) {
+        Square<T, 3> result;
+        for (size_t col = 0; col < 3; col++) {
+            const Vec3<T> column = mat.Multiply(Vec3<T>(T(col == 0), T(col == 1), T(col == 2)));
+            result.values[col] = column.GetX();
+            result.values[3 + col] = column.GetY();
+            result.values[6 + col] = column.GetZ();
+        }
+        return result;
+    }
+
+    template<typename T>
+    Square<T, 4> Elements(const Mat<T, 4, 4>& mat) {
+        Square<T, 4> result;
+        for (size_t index = 0; index < 16; index++) {
+            result.values[index] = mat.Get(index / 4, index % 4);
+        }
+        return result;
+    }
+
+    template<typename T, size_t N>
+    Square<long double, N> Abs(const Square<T, N>& m) {
+        Square<long double, N> result;
+        for (size_t index = 0; index < N * N; index++) {
+            result.values[index] = std::fabs(static_cast<long double>(m.values[index]));
+        }
+        return result;
+    }
+
+    template<size_t N>
+    Square<long double, N> Product(const Square<long double, N>& a, const Square<long double, N>& b) {
+        Square<long double, N> result;
+        for (size_t row = 0; row < N; row++) {
+            for (size_t col = 0; col < N; col++) {
+                long double sum = 0;
+                for (size_t k = 0; k < N; k++) {
+                    sum += a(row, k) * b(k, col);
+                }
+                result.values[row * N + col] = sum;
+            }
+        }
+        return result;
+    }
+
+    // Permanent of |m|, the sum of the magnitudes of the determinant's terms
+    template<size_t N>
+    long double Permanent(const Square<long double, N>& m) {
+        if constexpr (N == 1) {
+            return std::fabs(m.values[0]);
+        }
+        else {
+            long double sum = 0;
+            for (size_t skip = 0; skip < N; skip++) {
+                Square<long double, N - 1> minor;
+                for (size_t row = 1; row < N; row++) {
+                    for (size_t col = 0, out = 0; col < N; col++) {
+                        if (col != skip) {
+                            minor.values[(row - 1) * (N - 1) + out++] = m(row, col);
+                        }
+                    }
+                }
+                sum += std::fabs(m(0, skip)) * Permanent(minor);
+            }
+            return sum;
+        }
+    }
+
+    template<typename T, size_t N>
+    long double MaxElement(const Square<T, N>& m) {
+        long double result = 0;
+        for (T value : m.values) {
+            result = std::max(result, std::fabs(static_cast<long double>(value)));
+        }
+        return result;
+    }
+
+    template<typename T>
+    struct MatStats {
+        UlpStats<T> multiply, multiplyVec, transpose, scale, determinant, inverse, solve;
+    };
+
+    // Fuzz one square matrix type, given converters between Square and the
+    // matrix type in T and long double
+    template<typename T, size_t N, typename ToT, typename ToReference>
+    MatStats<T> Fuzz(uint64_t seed, const ToT& toT, const ToReference& toReference) {
+        Test::Random random(seed);
+        MatStats<T> stats;
+        for (size_t sample = 0; sample < Samples; sample++) {
+            const Square<T, N> a = RandomSquare<T, N>(random, false);
+            const Square<T, N> b = RandomSquare<T, N>(random, false);
+            const T s = T(random.Spread(100, 16));
+            const auto ma = toT(a);
+            const auto mb = toT(b);
+            const auto ra = toReference(Promote(a));
+            const auto rb = toReference(Promote(b));
+
+            const Square<T, N> product = Elements(ma.Multiply(mb));
+            const Square<long double, N> productReference = Elements(ra.Multiply(rb));
+            const Square<long double, N> productTerms = Product(Abs(a), Abs(b));
+            for (size_t index = 0; index < N * N; index++) {
+                stats.multiply.Add(product.values[index], productReference.values[index], productTerms.values[index]);
+            }
+
+            const Square<T, N> transposed = Elements(ma.Transpose());
+            const Square<T, N> scaled = Elements(ma.Scale(s));
+            for (size_t row = 0; row < N; row++) {
+                for (size_t col = 0; col < N; col++) {
+                    stats.transpose.Add(transposed(row, col), a(col, row));
+                    stats.scale.Add(scaled(row, col), static_cast<long double>(a(row, col)) * s);
+                }
+            }
+
+            stats.determinant.Add(ma.Determinant(), ra.Determinant(), Permanent(Abs(a)));
+
+            const Square<T, N> c = RandomSquare<T, N>(random, true);
+            const auto mc = toT(c);
+            const auto rc = toReference(Promote(c));
+            const Square<T, N> inverse = Elements(mc.Inverse());
+            const Square<long double, N> inverseReference = Elements(rc.Inverse());
+            long double largest = MaxElement(inverseReference);
+            for (size_t index = 0; index < N * N; index++) {
+                stats.inverse.Add(inverse.values[index], inverseReference.values[index], largest);
+            }
+        }
+        return stats;
+    }
+
+}
+
+TEST("Mat2 accuracy") {
+    auto run = [](auto zero, uint64_t seed, const char* type) {
+        using T = decltype(zero);
+        MatStats<T> stats = Fuzz<T, 2>(seed,
+            [](const Square<T, 2>& m) { return ToMat2(m); },
+            [](const Square<long double, 2>& m) { return ToMat2(m); });
+
+        Test::Random random(seed + 100);
+        for (size_t sample = 0; sample < Samples; sample++) {
+            const Square<T, 2> m = RandomSquare<T, 2>(random, false);
+            const Vec2<T> v(T(random.Spread(100, 16)), T(random.Spread(100, 16)));
+            const Vec2<T> product = ToMat2(m).Multiply(v);
+            const Vec2<long double> reference = ToMat2(Promote(m)).Multiply(Vec2<long double>(v.GetX(), v.GetY()));
+            stats.multiplyVec.Add(product.GetX(), reference.GetX(),
+                std::fabs(m(0, 0) * v.GetX()) + std::fabs(m(0, 1) * v.GetY()));
+            stats.multiplyVec.Add(product.GetY(), reference.GetY(),
+                std::fabs(m(1, 0) * v.GetX()) + std::fabs(m(1, 1) * v.GetY()));
+
+            const Square<T, 2> c = RandomSquare<T, 2>(random, true);
+            const Vec2<T> solved = ToMat2(c).Solve(v);
+            const Vec2<long double> exact = ToMat2(Promote(c)).Solve(Vec2<long double>(v.GetX(), v.GetY()));
+            long double largest = std::max(std::fabs(exact.GetX()), std::fabs(exact.GetY()));
+            stats.solve.Add(solved.GetX(), exact.GetX(), largest);
+            stats.solve.Add(solved.GetY(), exact.GetY(), largest);
+        }
+
+        std::string prefix = type;
+        CHECK_BUDGET((prefix + "::Multiply(Mat2)").c_str(), stats.multiply, 1.5, 0.4);
+        CHECK_BUDGET((prefix + "::Multiply(Vec2)").c_str(), stats.multiplyVec, 1.5, 0.4);
+        CHECK_BUDGET((prefix + "::Transpose").c_str(), stats.transpose, 0, 0);
+        CHECK_BUDGET((prefix + "::Scale").c_str(), stats.scale, 0.5, 0.3);
+        CHECK_BUDGET((prefix + "::Determinant").c_str(), stats.determinant, 1.5, 0.4);
+        CHECK_BUDGET((prefix + "::Inverse").c_str(), stats.inverse, 4, 1);
+        CHECK_BUDGET((prefix + "::Solve").c_str(), stats.solve, 4, 1);
+    };
+    run(0.0f, 201, "Mat2<float>");
+    run(0.0, 202, "Mat2<double>");
+}
+
+TEST("Mat3 accuracy") {
+    auto run = [](auto zero, uint64_t seed, const char* type) {
+        using T = decltype(zero);
+        MatStats<T> stats = Fuzz<T, 3>(seed,
+            [](const Square<T, 3>& m) { return ToMat3(m); },
+            [](const Square<long double, 3>& m) { return ToMat3(m); });
+
+        Test::Random random(seed + 100);
+        for (size_t sample = 0; sample < Samples; sample++) {
+            const Square<T, 3> m = RandomSquare<T, 3>(random, false);
+            const Vec3<T> v(T(random.Spread(100, 16)), T(random.Spread(100, 16)), T(random.Spread(100, 16)));
+            const Vec3<long double> rv(v.GetX(), v.GetY(), v.GetZ());
+            const Vec3<T> product = ToMat3(m).Multiply(v);
+            const Vec3<long double> reference = ToMat3(Promote(m)).Multiply(rv);
+            const Vec3<long double> terms = ToMat3(Abs(m)).Multiply(
+                Vec3<long double>(std::fabs(rv.GetX()), std::fabs(rv.GetY()), std::fabs(rv.GetZ())));
+            stats.multiplyVec.Add(product.GetX(), reference.GetX(), terms.GetX());
+            stats.multiplyVec.Add(product.GetY(), reference.GetY(), terms.GetY());
+            stats.multiplyVec.Add(product.GetZ(), reference.GetZ(), terms.GetZ());
+
+            const Square<T, 3> c = RandomSquare<T, 3>(random, true);
+            const Vec3<T> solved = ToMat3(c).Solve(v);
+            const Vec3<long double> exact = ToMat3(Promote(c)).Solve(rv);
+            long double largest = std::max({ std::fabs(exact.GetX()), std::fabs(exact.GetY()), std::fabs(exact.GetZ()) });
+            stats.solve.Add(solved.GetX(), exact.GetX(), largest);
+            stats.solve.Add(solved.GetY(), exact.GetY(), largest);
+            stats.solve.Add(solved.GetZ(), exact.GetZ(), largest);
+        }
+
+        std::string prefix = type;
+        CHECK_BUDGET((prefix + "::Multiply(Mat3)").c_str(), stats.multiply, 2, 0.45);
+        CHECK_BUDGET((prefix + "::Multiply(Vec3)").c_str(), stats.multiplyVec, 2, 0.45);
+        CHECK_BUDGET((prefix + "::Transpose").c_str(), stats.transpose, 0, 0);
+        CHECK_BUDGET((prefix + "::Scale").c_str(), stats.scale, 0.5, 0.3);
+        CHECK_BUDGET((prefix + "::Determinant").c_str(), stats.determinant, 3, 0.5);
+        CHECK_BUDGET((prefix + "::Inverse").c_str(), stats.inverse, 6, 1);
+        CHECK_BUDGET((prefix + "::Solve").c_str(), stats.solve, 8, 1.5);
+    };
+    run(0.0f, 301, "Mat3<float>");
+    run(0.0, 302, "Mat3<double>");
+}
+
+TEST("Mat<4, 4> accuracy") {
+    auto run = [](auto zero, uint64_t seed, const char* type) {
+        using T = decltype(zero);
+        MatStats<T> stats = Fuzz<T, 4>(seed,
+            [](const Square<T, 4>& m) { return ToMat4(m); },
+            [](const Square<long double, 4>& m) { return ToMat4(m); });
+        std::string prefix = type;
+        CHECK_BUDGET((prefix + "::Multiply").c_str(), stats.multiply, 2.5, 0.45);
+        CHECK_BUDGET((prefix + "::Transpose").c_str(), stats.transpose, 0, 0);
+        CHECK_BUDGET((prefix + "::Scale").c_str(), stats.scale, 0.5, 0.3);
+        // Elimination error grows with the pivots, beyond the closed forms above
+        CHECK_BUDGET((prefix + "::Determinant").c_str(), stats.determinant, 512, 1);
+        CHECK_BUDGET((prefix + "::Inverse").c_str(), stats.inverse, 12, 1.5);
+    };
+    run(0.0f, 401, "Mat<float, 4, 4>");
+    run(0.0, 402, "Mat<double, 4, 4>");
+}
+
+TEST("Mat singular inverse throws") {
+    bool thrown = false;
+    try {
+        Mat3<double>(1, 2, 3, 2, 4, 6, 1, 1, 1).Inverse();
+    }
+    catch (const MatrixException&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+TEST("CachedMat3 lookups follow every mutator") {
+    auto same = [](const Mat3<double>& first, const Mat3<double>& second) {
+        return Elements(first).values == Elements(second).values;
+    };
+    // Compare every cached lookup with the plain Mat3 computation
+    auto matches = [&](const CachedMat3<double>& cached, const Mat3<double>& expected) {
+        return same(cached.GetMatrix(), expected) && cached.Determinant() == expected.Determinant()
+            && same(cached.Transpose(), expected.Transpose()) && same(cached.Inverse(), expected.Inverse());
+    };
+    const Mat3<double> a(4, 1, 0, 1, 3, 1, 0, 1, 2);
+    const Mat3<double> b(2, 0, 1, 0, 1, 0, 1, 0, 3);
+    const Mat3<double> singular(1, 2, 3, 2, 4, 6, 1, 1, 1);
+
+    CachedMat3<double> cached(a);
+    CHECK(matches(cached, a));
+    uint64_t version = cached.GetVersion();
+    cached.Scale(2.0);
+    CHECK(cached.GetVersion() == ++version);
+    CHECK(matches(cached, a.Scale(2.0)));
+    cached.Multiply(b);
+    CHECK(cached.GetVersion() == ++version);
+    CHECK(matches(cached, a.Scale(2.0).Multiply(b)));
+    cached.Set(b);
+    CHECK(cached.GetVersion() == ++version);
+    CHECK(matches(cached, b));
+
+    // Transposing an up to date cache transposes it in place, so the inverse
+    // is the transposed inverse of b. A stale cache is simply refilled.
+    cached.Transpose();
+    CHECK(cached.GetVersion() == ++version);
+    CHECK(same(cached.GetMatrix(), b.Transpose()));
+    CHECK(same(cached.Transpose(), b));
+    CHECK(cached.Determinant() == b.Determinant());
+    CHECK(same(cached.Inverse(), b.Inverse().Transpose()));
+    cached.Set(a);
+    cached.Transpose();
+    CHECK(matches(cached, a.Transpose()));
+
+    // A matrix that was invertible becomes singular
+    cached.Set(a);
+    CHECK(matches(cached, a));
+    cached.Set(singular);
+    CHECK(cached.Determinant() == 0);
+    bool thrown = false;
+    try {
+        cached.Solve(Vec3<double>(1, 2, 3));
+    }
+    catch (const MatrixException& exception) {
+        thrown = std::string(exception.what()) == "Matrix is not invertible";
+    }
+    CHECK(thrown);
+    cached.Set(a);
+    CHECK(matches(cached, a));
+
+    // Copies keep an up to date cache and drop a stale one, and never share
+    // later changes with their source
+    CachedMat3<double> copy(cached);
+    CHECK(matches(copy, a));
+    cached.Set(b);
+    CHECK(matches(copy, a));
+    CachedMat3<double> staleCopy(cached);
+    CHECK(matches(staleCopy, b));
+    copy = cached;
+    CHECK(matches(copy, b));
+    cached.Scale(3.0);
+    copy = cached;
+    CHECK(matches(copy, b.Scale(3.0)));
+    CachedMat3<double> moved(std::move(copy));
+    CHECK(matches(moved, b.Scale(3.0)));
+    moved = CachedMat3<double>(singular);
+    CHECK(same(moved.GetMatrix(), singular));
+    CHECK(moved.Determinant() == 0);
+}
@@ -0,0 +1,227 @@
+#include "Test.h"
+
+#include "Random/Philox.h"
+#include "Random/Sample.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Philox against the Random123 known answers, batched sampling split into
+// chunks against one call, and the moments of every distribution
+
+using namespace Math;
+
+namespace {
+
+    constexpr size_t Count = 1 << 16;
+
+    // Philox block for a Random123 counter and key, the counter words are
+    // (counter low, counter high, stream low, stream high)
+    Philox::Block Random123(const Philox::Block& counter, uint32_t key0, uint32_t key1) {
+        const Philox generator((uint64_t(key1) << 32) | key0, (uint64_t(counter[3]) << 32) | counter[2]);
+        return generator.Generate((uint64_t(counter[1]) << 32) | counter[0]);
+    }
+
+    // Fill out with sample calls over chunks of varying size, each passing
+    // the index of its first sample
+    template<typename T, typename Fill>
+    void FillChunked(std::vector<T>& out, const Fill& fill) {
+        size_t sizes[] = { 1, 3, 2, 7, 64, 5, 1000 };
+        size_t first = 0;
+        for (size_t step = 0; first < out.size(); step++) {
+            size_t size = std::min(sizes[step % 7], out.size() - first);
+            fill(first, out.data() + first, size);
+            first += size;
+        }
+    }
+
+    bool Same(float first, float second) { return first == second; }
+
+    bool Same(const Vec2<float>& first, const Vec2<float>& second) {
+        return first.GetX() == second.GetX() && first.GetY() == second.GetY();
+    }
+
+    bool Same(const Vec3<float>& first, const Vec3<float>& second) {
+        return first.GetX() == second.GetX() && first.GetY() == second.GetY() && first.GetZ() == second.GetZ();
+    }
+
+    // Whether a batch filled in one call equals the same batch in chunks
+    template<typename T, typename Fill>
+    bool ChunksMatch(const T& zero, const Fill& fill) {
+        std::vector<T> whole(1 << 12, zero), chunked(1 << 12, zero);
+        fill(0, whole.data(), whole.size());
+        FillChunked(chunked, fill);
+        bool same = true;
+        for (size_t index = 0; index < whole.size(); index++) {
+            same = same && Same(whole[index], chunked[index]);
+        }
+        return same;
+    }
+
+    // Whether the sample mean of count values is within five standard
+    // errors of expected, for values with the given variance
+    bool MeanWithin(double sum, size_t count, double expected, double variance) {
+        return std::fabs(sum / double(count) - expected) < 5 * std::sqrt(variance / double(count));
+    }
+
+}
+
+TEST("Philox matches the Random123 known answers") {
+    const Philox::Block zero = Random123({ { 0, 0, 0, 0 } }, 0, 0);
+    const Philox::Block ones = Random123({ { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu } },
+        0xFFFFFFFFu, 0xFFFFFFFFu);
+    const Philox::Block pi = Random123({ { 0x243F6A88u, 0x85A308D3u, 0x13198A2Eu, 0x03707344u } },
+        0xA4093822u, 0x299F31D0u);
+    CHECK((zero == Philox::Block{ { 0x6627E8D5u, 0xE169C58Du, 0xBC57AC4Cu, 0x9B00DBD8u } }));
+    CHECK((ones == Philox::Block{ { 0x408F276Du, 0x41C83B0Eu, 0xA20BC7C6u, 0x6D5451FDu } }));
+    CHECK((pi == Philox::Block{ { 0xD16CFE09u, 0x94FDCCEBu, 0x5001E420u, 0x24126EA1u } }));
+
+    // Next and Discard walk the same counters as Generate
+    Philox generator(7, 3);
+    CHECK(generator.Next() == generator.Generate(0));
+    generator.Discard(10);
+    CHECK(generator.Next() == generator.Generate(11));
+    CHECK(generator.GetCounter() == 12);
+}
+
+TEST("Sample batches split into chunks match one call") {
+    const Philox generator(1601, 2, 5);
+    const Vec3<float> zero3(0, 0, 0);
+    const Vec2<float> zero2(0, 0);
+    CHECK(ChunksMatch(0.0f, [&](uint64_t first, float* out, size_t count) {
+        Sample::Uniform(generator, first, out, count, -2.0f, 3.0f);
+    }));
+    CHECK(ChunksMatch(zero2, [&](uint64_t first, Vec2<float>* out, size_t count) {
+        Sample::Uniform(generator, first, out, count, Vec2<float>(0, 1), Vec2<float>(2, 3));
+    }));
+    CHECK(ChunksMatch(zero3, [&](uint64_t first, Vec3<float>* out, size_t count) {
+        Sample::Uniform(generator, first, out, count, Vec3<float>(0, 1, 2), Vec3<float>(2, 3, 4));
+    }));
+    CHECK(ChunksMatch(0.0f, [&](uint64_t first, float* out, size_t count) {
+        Sample::Gaussian(generator, first, out, count, 1.0f, 2.0f);
+    }));
+    CHECK(ChunksMatch(zero2, [&](uint64_t first, Vec2<float>* out, size_t count) {
+        Sample::Gaussian(generator, first, out, count, zero2);
+    }));
+    CHECK(ChunksMatch(zero3, [&](uint64_t first, Vec3<float>* out, size_t count) {
+        Sample::Gaussian(generator, first, out, count, zero3);
+    }));
+    CHECK(ChunksMatch(zero2, [&](uint64_t first, Vec2<float>* out, size_t count) {
+        Sample::Circle(generator, first, out, count);
+    }));
+    CHECK(ChunksMatch(zero3, [&](uint64_t first, Vec3<float>* out, size_t count) {
+        Sample::Sphere(generator, first, out, count);
+    }));
+    CHECK(ChunksMatch(zero3, [&](uint64_t first, Vec3<float>* out, size_t count) {
+        Sample::Sphere<FastMath::Accuracy::FAST>(generator, first, out, count);
+    }));
+    CHECK(ChunksMatch(zero3, [&](uint64_t first, Vec3<float>* out, size_t count) {
+        Sample::Hemisphere(generator, first, out, count, Vec3<float>(1, 2, -2));
+    }));
+}
+
+TEST("Sample distributions have the expected moments") {
+    const Philox generator(1602);
+
+    std::vector<float> uniform(Count);
+    Sample::Uniform(generator, 0, uniform.data(), Count, -1.0f, 3.0f);
+    double sum = 0, sumSqr = 0;
+    bool inRange = true;
+    for (float value : uniform) {
+        sum += value;
+        sumSqr += (value - 1.0) * (value - 1.0);
+        inRange = inRange && value >= -1.0f && value < 3.0f;
+    }
+    // Uniform on [-1, 3): mean 1, variance 16 / 12, fourth central moment 256 / 80
+    CHECK(inRange);
+    CHECK(MeanWithin(sum, Count, 1.0, 16.0 / 12));
+    CHECK(MeanWithin(sumSqr, Count, 16.0 / 12, 256.0 / 80 - (16.0 / 12) * (16.0 / 12)));
+
+    std::vector<float> gaussian(Count);
+    Sample::Gaussian(generator, 0, gaussian.data(), Count, 2.0f, 0.5f);
+    sum = 0, sumSqr = 0;
+    double sumFourth = 0;
+    for (float value : gaussian) {
+        double centered = (value - 2.0) / 0.5;
+        sum += centered;
+        sumSqr += centered * centered;
+        sumFourth += centered * centered * centered * centered;
+    }
+    // Standard normal: mean 0, variance 1, fourth moment 3 with variance 96
+    CHECK(MeanWithin(sum, Count, 0.0, 1.0));
+    CHECK(MeanWithin(sumSqr, Count, 1.0, 2.0));
+    CHECK(MeanWithin(sumFourth, Count, 3.0, 96.0));
+
+    std::vector<Vec3<float>> gaussian3(Count, Vec3<float>(0, 0, 0));
+    Sample::Gaussian(generator, 0, gaussian3.data(), Count, Vec3<float>(0, 0, 0));
+    double sums[3] = { 0, 0, 0 }, squares[3] = { 0, 0, 0 }, cross = 0;
+    for (const Vec3<float>& value : gaussian3) {
+        float components[3] = { value.GetX(), value.GetY(), value.GetZ() };
+        for (int axis = 0; axis < 3; axis++) {
+            sums[axis] += components[axis];
+            squares[axis] += double(components[axis]) * components[axis];
+        }
+        cross += double(components[0]) * components[2];
+    }
+    bool normal = MeanWithin(cross, Count, 0.0, 1.0);
+    for (int axis = 0; axis < 3; axis++) {
+        normal = normal && MeanWithin(sums[axis], Count, 0.0, 1.0) && MeanWithin(squares[axis], Count, 1.0, 2.0);
+    }
+    CHECK(normal);
+
+    // Uniform on the sphere: unit length, each component has mean 0 and
+    // E[x^2] = 1/3 with variance 1/5 - 1/9, and z is uniform on [-1, 1]
+    std::vector<Vec3<float>> sphere(Count, Vec3<float>(0, 0, 0));
+    Sample::Sphere(generator, 0, sphere.data(), Count);
+    bool unit = true;
+    for (int axis = 0; axis < 3; axis++) {
+        sums[axis] = 0;
+        squares[axis] = 0;
+    }
+    size_t upperHalf = 0;
+    for (const Vec3<float>& value : sphere) {
+        unit = unit && std::fabs(value.Magnitude() - 1.0f) < 1e-5f;
+        float components[3] = { value.GetX(), value.GetY(), value.GetZ() };
+        for (int axis = 0; axis < 3; axis++) {
+            sums[axis] += components[axis];
+            squares[axis] += double(components[axis]) * components[axis];
+        }
+        upperHalf += value.GetZ() > 0.5f;
+    }
+    bool isotropic = MeanWithin(double(upperHalf), Count, 0.25, 0.25 * 0.75);
+    for (int axis = 0; axis < 3; axis++) {
+        isotropic = isotropic && MeanWithin(sums[axis], Count, 0.0, 1.0 / 3)
+            && MeanWithin(squares[axis], Count, 1.0 / 3, 1.0 / 5 - 1.0 / 9);
+    }
+    CHECK(unit);
+    CHECK(isotropic);
+
+    // The hemisphere keeps directions on the side of the normal, where the
+    // cosine to the normal is uniform on [0, 1]
+    const Vec3<float> normalDirection(1, 2, -2);
+    std::vector<Vec3<float>> hemisphere(Count, Vec3<float>(0, 0, 0));
+    Sample::Hemisphere(generator, 0, hemisphere.data(), Count, normalDirection);
+    bool above = true;
+    sum = 0;
+    for (const Vec3<float>& value : hemisphere) {
+        double cosine = value.Dot(normalDirection) / 3.0;
+        above = above && cosine >= 0;
+        sum += cosine;
+    }
+    CHECK(above);
+    CHECK(MeanWithin(sum, Count, 0.5, 1.0 / 12));
+
+    std::vector<Vec2<float>> circle(Count, Vec2<float>(0, 0));
+    Sample::Circle(generator, 0, circle.data(), Count);
+    unit = true;
+    double sumX = 0, sumY = 0;
+    for (const Vec2<float>& value : circle) {
+        unit = unit && std::fabs(value.Magnitude() - 1.0f) < 1e-5f;
+        sumX += value.GetX();
+        sumY += value.GetY();
+    }
+    CHECK(unit);
+    CHECK(MeanWithin(sumX, Count, 0.0, 0.5));
+    CHECK(MeanWithin(sumY, Count, 0.0, 0.5));
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include "Random/Philox.h"
+#include "Ulp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Minimal test harness for MathUtil_tests. Tests fuzz an operation with
+// seeded inputs, compare it against the same template instantiated with
+// long double, and assert a budget on the maximum and mean ulp error.
+// Benchmarks time a fast path against a reference path and report the
+// speedup against an expected minimum. Timings depend on the machine and
+// its load, so a speedup below the minimum only fails with --strict.
+namespace Test {
+
+    enum class Kind {
+        TEST,
+        BENCHMARK
+    };
+
+    struct Case {
+        const char* name;
+        Kind kind;
+        void (*function)();
+    };
+
+    inline std::vector<Case>& Registry() {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    struct Register {
+        Register(const char* name, Kind kind, void (*function)()) {
+            Registry().push_back(Case{ name, kind, function });
+        }
+    };
+
+    // Number of failed checks in the running case
+    inline size_t& Failures() {
+        static size_t failures = 0;
+        return failures;
+    }
+
+    inline void Fail(const char* file, int line, const std::string& message) {
+        std::cout << "    FAILED " << file << ":" << line << ": " << message << "\n";
+        Failures()++;
+    }
+
+    // Whether speedups below their budget fail the benchmark, set by --strict
+    inline bool& Strict() {
+        static bool strict = false;
+        return strict;
+    }
+
+    // Whether the build is optimized. Speedup budgets only hold for
+    // optimized code, so unoptimized builds report timings without failing.
+    constexpr bool Optimized =
+#if defined(__OPTIMIZE__) || (defined(_MSC_VER) && defined(NDEBUG))
+        true;
+#else
+        false;
+#endif
+
+    // Print the error statistics of one operation and fail when they exceed
+    // the budget
+    template<typename T>
+    void CheckBudget(const char* file, int line, const char* operation,
+        const Math::UlpStats<T>& stats, long double maxBudget, long double meanBudget) {
+        std::cout << "    " << operation << " " << stats << "\n";
+        if (!stats.Within(maxBudget, meanBudget)) {
+            Fail(file, line, std::string(operation) + " exceeds its budget of max "
+                + std::to_string(double(maxBudget)) + " ulp, mean " + std::to_string(double(meanBudget))
+                + " ulp, worst at sample " + std::to_string(stats.GetWorst()));
+        }
+    }
+
+    // Seeded source of fuzz inputs built on Philox, so every run and every
+    // platform sees the same values
+    class Random {
+
+    public:
+
+        explicit Random(uint64_t seed) : generator(seed) {}
+
+        // Uniform in [low, high)
+        double Uniform(double low, double high) {
+            if (used == 4) {
+                block = generator.Next();
+                used = 0;
+            }
+            uint64_t bits = (uint64_t(block[used]) << 32) | block[used + 1];
+            used += 2;
+            return low + (high - low) * double(bits >> 11) * 0x1.0p-53;
+        }
+
+        // Uniform in [-range, range) with a log-uniform magnitude in
+        // [2^-exponents, 1) times range, to cover many binades
+        double Spread(double range, int exponents) {
+            double magnitude = range * std::exp2(-Uniform(0.0, double(exponents)));
+            return Uniform(0.0, 1.0) < 0.5 ? -magnitude : magnitude;
+        }
+
+    private:
+
+        Math::Philox generator;
+        Math::Philox::Block block{};
+        size_t used = 4;
+
+    };
+
+    // Time of one run of function repeated for at least 20 ms, in
+    // nanoseconds per item
+    template<typename Function>
+    double MeasureOnce(size_t items, const Function& function) {
+        using Clock = std::chrono::steady_clock;
+        size_t repeats = 0;
+        auto start = Clock::now();
+        auto elapsed = Clock::duration::zero();
+        do {
+            function();
+            repeats++;
+            elapsed = Clock::now() - start;
+        } while (elapsed < std::chrono::milliseconds(20));
+        return std::chrono::duration<double, std::nano>(elapsed).count() / double(repeats * items);
+    }
+
+    // Best times of two functions over several runs, in nanoseconds per
+    // item. The runs alternate, so both functions see the same clock speed
+    // and machine load and their ratio does not drift with either.
+    template<typename First, typename Second>
+    void MeasurePair(size_t items, const First& first, const Second& second, double& firstNs, double& secondNs) {
+        firstNs = MeasureOnce(items, first);
+        secondNs = MeasureOnce(items, second);
+        for (int run = 1; run < 9; run++) {
+            firstNs = std::min(firstNs, MeasureOnce(items, first));
+            secondNs = std::min(secondNs, MeasureOnce(items, second));
+        }
+    }
+
+    // Print two timings and flag fast when it is not at least minimum times
+    // quicker than reference. Only fails in a strict run of an optimized build.
+    inline void CheckSpeedup(const char* file, int line, const char* operation,
+        double fastNs, double referenceNs, double minimum) {
+        double speedup = referenceNs / fastNs;
+        std::cout << "    " << operation << " " << fastNs << " ns against " << referenceNs
+            << " ns, " << speedup << "x (budget " << minimum << "x)\n";
+        if (speedup >= minimum) {
+            return;
+        }
+        if (Optimized && Strict()) {
+            Fail(file, line, std::string(operation) + " is slower than its budget");
+        }
+        else {
+            std::cout << "    " << operation << " is below its budget, not enforced without --strict\n";
+        }
+    }
+
+    // Print the time of one operation and flag it when it takes longer than
+    // budget seconds. Only fails in a strict run of an optimized build.
+    inline void CheckTime(const char* file, int line, const char* operation, double seconds, double budget) {
+        std::cout << "    " << operation << " " << seconds << " s (budget " << budget << " s)\n";
+        if (seconds <= budget) {
+            return;
+        }
+        if (Optimized && Strict()) {
+            Fail(file, line, std::string(operation) + " is slower than its budget");
+        }
+        else {
+            std::cout << "    " << operation << " is over its budget, not enforced without --strict\n";
+        }
+    }
+
+    inline volatile unsigned char Sink = 0;
+
+    // Keep a value alive so the optimizer cannot drop the work producing it.
+    // Every byte reaches the sink, so no part of the value can be skipped.
+    template<typename T>
+    void Consume(const T& value) {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        unsigned char folded = 0;
+        for (unsigned char byte : bytes) {
+            folded ^= byte;
+        }
+        Sink = folded;
+    }
+
+}
+
+#define MATHUTIL_CONCAT_INNER(first, second) first##second
+#define MATHUTIL_CONCAT(first, second) MATHUTIL_CONCAT_INNER(first, second)
+
+#define MATHUTIL_CASE(name, kind) \
+    static void MATHUTIL_CONCAT(Case_, __LINE__)(); \
+    static const Test::Register MATHUTIL_CONCAT(Register_, __LINE__)(name, kind, &MATHUTIL_CONCAT(Case_, __LINE__)); \
+    static void MATHUTIL_CONCAT(Case_, __LINE__)()
+
+// Define a correctness or accuracy test
+#define TEST(name) MATHUTIL_CASE(name, Test::Kind::TEST)
+
+// Define a benchmark
+#define BENCHMARK(name) MATHUTIL_CASE(name, Test::Kind::BENCHMARK)
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            Test::Fail(__FILE__, __LINE__, #condition); \
+        } \
+    } while (false)
+
+#define CHECK_BUDGET(operation, stats, maxBudget, meanBudget) \
+    Test::CheckBudget(__FILE__, __LINE__, operation, stats, maxBudget, meanBudget)
+
+#define CHECK_SPEEDUP(operation, fastNs, referenceNs, minimum) \
+    Test::CheckSpeedup(__FILE__, __LINE__, operation, fastNs, referenceNs, minimum)
+
+#define CHECK_TIME(operation, seconds, budget) \
+    Test::CheckTime(__FILE__, __LINE__, operation, seconds, budget)
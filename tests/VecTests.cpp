@@ -0,0 +1,248 @@
+#include "Test.h"
+
+#include "Vec.h"
+#include "Vec2.h"
+#include "Vec3.h"
+
+#include <cmath>
+
+// Vec2, Vec3 and Vec fuzzed against the same templates in long double. Ops
+// whose result can cancel (Dot, Cross, ProjectOnto) measure their error in
+// ulps of the magnitude of the terms, which is what rounding error grows with.
+
+using namespace Math;
+
+namespace {
+
+    constexpr size_t Samples = 100000;
+
+    template<typename T>
+    struct VecStats {
+        UlpStats<T> add, scale, scaleVector, normalize, direction, magnitude;
+        UlpStats<T> distance, distanceSqr, dot, cross, angle, project;
+    };
+
+    template<typename T>
+    Vec2<T> RandomVec2(Test::Random& random) {
+        return Vec2<T>(T(random.Spread(100, 16)), T(random.Spread(100, 16)));
+    }
+
+    template<typename T>
+    Vec3<T> RandomVec3(Test::Random& random) {
+        return Vec3<T>(T(random.Spread(100, 16)), T(random.Spread(100, 16)), T(random.Spread(100, 16)));
+    }
+
+    template<typename T>
+    Vec2<long double> Promote(const Vec2<T>& vec) {
+        return Vec2<long double>(vec.GetX(), vec.GetY());
+    }
+
+    template<typename T>
+    Vec3<long double> Promote(const Vec3<T>& vec) {
+        return Vec3<long double>(vec.GetX(), vec.GetY(), vec.GetZ());
+    }
+
+    template<typename T, size_t N>
+    Vec<long double, N> Promote(const Vec<T, N>& vec) {
+        std::array<long double, N> values;
+        for (size_t index = 0; index < N; index++) {
+            values[index] = vec[int(index)];
+        }
+        return Vec<long double, N>(values);
+    }
+
+    template<typename T>
+    void Report(const char* type, const VecStats<T>& stats, bool hasCross) {
+        std::string prefix = type;
+        CHECK_BUDGET((prefix + "::Add").c_str(), stats.add, 0.5, 0.3);
+        CHECK_BUDGET((prefix + "::Scale(vector)").c_str(), stats.scaleVector, 0.5, 0.3);
+        CHECK_BUDGET((prefix + "::Scale(scalar)").c_str(), stats.scale, 0.5, 0.3);
+        CHECK_BUDGET((prefix + "::Normalize").c_str(), stats.normalize, 3, 1);
+        CHECK_BUDGET((prefix + "::DirectionTo").c_str(), stats.direction, 4.5, 1);
+        CHECK_BUDGET((prefix + "::Magnitude").c_str(), stats.magnitude, 2, 0.6);
+        CHECK_BUDGET((prefix + "::DistanceTo").c_str(), stats.distance, 2, 0.6);
+        CHECK_BUDGET((prefix + "::DistanceSqrTo").c_str(), stats.distanceSqr, 4, 0.7);
+        CHECK_BUDGET((prefix + "::Dot").c_str(), stats.dot, 2.5, 0.5);
+        if (hasCross) {
+            CHECK_BUDGET((prefix + "::Cross").c_str(), stats.cross, 1.5, 0.5);
+        }
+        CHECK_BUDGET((prefix + "::AngleTo").c_str(), stats.angle, 4, 1);
+        CHECK_BUDGET((prefix + "::ProjectOnto").c_str(), stats.project, 6, 1);
+    }
+
+    template<typename T>
+    void FuzzVec2(const char* type, uint64_t seed) {
+        Test::Random random(seed);
+        VecStats<T> stats;
+        for (size_t sample = 0; sample < Samples; sample++) {
+            const Vec2<T> a = RandomVec2<T>(random);
+            const Vec2<T> b = RandomVec2<T>(random);
+            const T s = T(random.Spread(100, 16));
+            const Vec2<long double> ra = Promote(a);
+            const Vec2<long double> rb = Promote(b);
+
+            stats.add.Add(a.Add(b), ra.Add(rb));
+            stats.scaleVector.Add(a.Scale(b), ra.Scale(rb));
+            stats.scale.Add(a.Scale(s), ra.Scale(s));
+            stats.normalize.Add(a.Normalize(), ra.Normalize());
+            stats.direction.Add(a.DirectionTo(b), ra.DirectionTo(rb));
+            stats.magnitude.Add(a.Magnitude(), ra.Magnitude());
+            stats.distance.Add(a.DistanceTo(b), ra.DistanceTo(rb));
+            stats.distanceSqr.Add(a.DistanceSqrTo(b), ra.DistanceSqrTo(rb));
+
+            long double terms = std::fabs(ra.GetX() * rb.GetX()) + std::fabs(ra.GetY() * rb.GetY());
+            stats.dot.Add(a.Dot(b), ra.Dot(rb), terms);
+            long double crossTerms = std::fabs(ra.GetX() * rb.GetY()) + std::fabs(ra.GetY() * rb.GetX());
+            stats.cross.Add(a.Cross(b), ra.Cross(rb), crossTerms);
+            // Angles are compared in ulps of 1 radian, since |cross| may cancel
+            stats.angle.Add(a.AngleTo(b), ra.AngleTo(rb), 1.0L);
+
+            const Vec2<T> projected = a.ProjectOnto(b);
+            const Vec2<long double> reference = ra.ProjectOnto(rb);
+            long double factor = terms / rb.Dot(rb);
+            stats.project.Add(projected.GetX(), reference.GetX(), factor * std::fabs(rb.GetX()));
+            stats.project.Add(projected.GetY(), reference.GetY(), factor * std::fabs(rb.GetY()));
+        }
+        Report(type, stats, true);
+    }
+
+    template<typename T>
+    void FuzzVec3(const char* type, uint64_t seed) {
+        Test::Random random(seed);
+        VecStats<T> stats;
+        for (size_t sample = 0; sample < Samples; sample++) {
+            const Vec3<T> a = RandomVec3<T>(random);
+            const Vec3<T> b = RandomVec3<T>(random);
+            const T s = T(random.Spread(100, 16));
+            const Vec3<long double> ra = Promote(a);
+            const Vec3<long double> rb = Promote(b);
+
+            stats.add.Add(a.Add(b), ra.Add(rb));
+            stats.scaleVector.Add(a.Scale(b), ra.Scale(rb));
+            stats.scale.Add(a.Scale(s), ra.Scale(s));
+            stats.normalize.Add(a.Normalize(), ra.Normalize());
+            stats.direction.Add(a.DirectionTo(b), ra.DirectionTo(rb));
+            stats.magnitude.Add(a.Magnitude(), ra.Magnitude());
+            stats.distance.Add(a.DistanceTo(b), ra.DistanceTo(rb));
+            stats.distanceSqr.Add(a.DistanceSqrTo(b), ra.DistanceSqrTo(rb));
+
+            long double terms = std::fabs(ra.GetX() * rb.GetX()) + std::fabs(ra.GetY() * rb.GetY())
+                + std::fabs(ra.GetZ() * rb.GetZ());
+            stats.dot.Add(a.Dot(b), ra.Dot(rb), terms);
+
+            const Vec3<T> cross = a.Cross(b);
+            const Vec3<long double> crossReference = ra.Cross(rb);
+            stats.cross.Add(cross.GetX(), crossReference.GetX(),
+                std::fabs(ra.GetY() * rb.GetZ()) + std::fabs(ra.GetZ() * rb.GetY()));
+            stats.cross.Add(cross.GetY(), crossReference.GetY(),
+                std::fabs(ra.GetZ() * rb.GetX()) + std::fabs(ra.GetX() * rb.GetZ()));
+            stats.cross.Add(cross.GetZ(), crossReference.GetZ(),
+                std::fabs(ra.GetX() * rb.GetY()) + std::fabs(ra.GetY() * rb.GetX()));
+            stats.angle.Add(a.AngleTo(b), ra.AngleTo(rb), 1.0L);
+
+            const Vec3<T> projected = a.ProjectOnto(b);
+            const Vec3<long double> reference = ra.ProjectOnto(rb);
+            long double factor = terms / rb.Dot(rb);
+            stats.project.Add(projected.GetX(), reference.GetX(), factor * std::fabs(rb.GetX()));
+            stats.project.Add(projected.GetY(), reference.GetY(), factor * std::fabs(rb.GetY()));
+            stats.project.Add(projected.GetZ(), reference.GetZ(), factor * std::fabs(rb.GetZ()));
+        }
+        Report(type, stats, true);
+    }
+
+    template<typename T>
+    void FuzzVec4(const char* type, uint64_t seed) {
+        constexpr size_t N = 4;
+        Test::Random random(seed);
+        VecStats<T> stats;
+        auto randomVec = [&random] {
+            std::array<T, N> values;
+            for (T& value : values) {
+                value = T(random.Spread(100, 16));
+            }
+            return Vec<T, N>(values);
+        };
+        for (size_t sample = 0; sample < Samples; sample++) {
+            const Vec<T, N> a = randomVec();
+            const Vec<T, N> b = randomVec();
+            const T s = T(random.Spread(100, 16));
+            const Vec<long double, N> ra = Promote(a);
+            const Vec<long double, N> rb = Promote(b);
+
+            stats.add.Add(a.Add(b), ra.Add(rb));
+            stats.scaleVector.Add(a.Scale(b), ra.Scale(rb));
+            stats.scale.Add(a.Scale(s), ra.Scale(s));
+            stats.normalize.Add(a.Normalize(), ra.Normalize());
+            stats.direction.Add(a.DirectionTo(b), ra.DirectionTo(rb));
+            stats.magnitude.Add(a.Magnitude(), ra.Magnitude());
+            stats.distance.Add(a.DistanceTo(b), ra.DistanceTo(rb));
+            stats.distanceSqr.Add(a.DistanceSqrTo(b), ra.DistanceSqrTo(rb));
+
+            long double terms = 0;
+            for (size_t index = 0; index < N; index++) {
+                terms += std::fabs(ra[int(index)] * rb[int(index)]);
+            }
+            stats.dot.Add(a.Dot(b), ra.Dot(rb), terms);
+            stats.angle.Add(a.AngleTo(b), ra.AngleTo(rb), 1.0L);
+
+            const Vec<T, N> projected = a.ProjectOnto(b);
+            const Vec<long double, N> reference = ra.ProjectOnto(rb);
+            long double factor = terms / rb.Dot(rb);
+            for (size_t index = 0; index < N; index++) {
+                stats.project.Add(projected[int(index)], reference[int(index)], factor * std::fabs(rb[int(index)]));
+            }
+        }
+        Report(type, stats, false);
+    }
+
+}
+
+TEST("Vec2<float> accuracy") { FuzzVec2<float>("Vec2<float>", 21); }
+
+TEST("Vec2<double> accuracy") { FuzzVec2<double>("Vec2<double>", 22); }
+
+TEST("Vec3<float> accuracy") { FuzzVec3<float>("Vec3<float>", 31); }
+
+TEST("Vec3<double> accuracy") { FuzzVec3<double>("Vec3<double>", 32); }
+
+TEST("Vec<float, 4> accuracy") { FuzzVec4<float>("Vec<float, 4>", 41); }
+
+TEST("Vec<double, 4> accuracy") { FuzzVec4<double>("Vec<double, 4>", 42); }
+
+TEST("Vec zero vector errors") {
+    bool thrown = false;
+    try {
+        Vec3<float>(0, 0, 0).Normalize();
+    }
+    catch (const VectorException&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+    thrown = false;
+    try {
+        Vec2<double>(1, 2).ProjectOnto(Vec2<double>(0, 0));
+    }
+    catch (const VectorException&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+TEST("Vec value lists must match the size") {
+    auto throws = [](auto function) {
+        try {
+            function();
+        }
+        catch (const VectorException&) {
+            return true;
+        }
+        return false;
+    };
+    const Vec<float, 4> vec{ 1.0f, 2.0f, 3.0f, 4.0f };
+    CHECK(vec.Add({ 1.0f, 1.0f, 1.0f, 1.0f })[3] == 5.0f);
+    CHECK(throws([] { Vec<float, 4> shorter{ 1.0f, 2.0f, 3.0f }; }));
+    CHECK(throws([&] { vec.Add({ 1.0f, 2.0f }); }));
+    CHECK(throws([&] { vec.Scale({ 1.0f, 2.0f, 3.0f, 4.0f, 5.0f }); }));
+    CHECK(throws([&] { Vec<float, 4>(vec).Add({ 1.0f }); }));
+    CHECK(throws([&] { Vec<float, 4>(vec).Scale({ 1.0f, 2.0f, 3.0f }); }));
+}